@@ -0,0 +1,25 @@
+/**
+ * @file: bench.h
+ * @author: Paweł Kawula (pawel.kawula@kelectronics.pl)
+ * @brief: Interface between the benchmark driver and the per-configuration call sites
+ * -----
+ * Copyright 2025 - KElectronics
+ * -----
+ */
+
+#ifndef BENCH_H
+#define BENCH_H
+
+/* Log calls executed by one iteration of a workload (see bench_sites.c) */
+#define BENCH_CALLS_PER_ITERATION 8
+
+/* Frame address of the running workload, used to measure stack depth in the sinks */
+extern char *volatile bench_site_frame;
+
+typedef struct
+{
+    const char *name;
+    void (*run)(unsigned iterations);
+} Bench_Variant_t;
+
+#endif /* BENCH_H */
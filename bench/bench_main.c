@@ -0,0 +1,230 @@
+/**
+ * @file: bench_main.c
+ * @author: Paweł Kawula (pawel.kawula@kelectronics.pl)
+ * @brief: Logging benchmark driver - ns/call and stack depth per configuration and sink
+ * -----
+ * Copyright 2025 - KElectronics
+ * -----
+ * @note: Results go to stderr so that the stdout sink can be redirected:
+ *        ./logging_bench [iterations] > /dev/null
+ *        Code size per configuration is reported by size_report.py.
+ *        The built-in formatter is checked against snprintf() first.
+ */
+
+#include <math.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "bench.h"
+#include "logging.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define BENCH_HAS_CYCLES 1
+#define BENCH_CYCLES() __builtin_ia32_rdtsc()
+#else
+#define BENCH_HAS_CYCLES 0
+#define BENCH_CYCLES() 0u
+#endif
+
+/* Generated by CMake: BENCH_VARIANT(entry, "name") per configuration */
+#define BENCH_VARIANT(entry, name) void entry(unsigned iterations);
+#include "bench_variants.h"
+#undef BENCH_VARIANT
+
+#define BENCH_VARIANT(entry, name) { name, entry },
+static const Bench_Variant_t variants[] = {
+#include "bench_variants.h"
+};
+#undef BENCH_VARIANT
+
+char *volatile bench_site_frame;
+static size_t bench_stack_depth;
+
+static void bench_record_stack(void)
+{
+    char marker;
+    size_t depth = (size_t)(bench_site_frame - &marker);
+
+    if (depth > bench_stack_depth)
+    {
+        bench_stack_depth = depth;
+    }
+}
+
+static int null_sink(const char *message, ...)
+{
+    (void)message;
+    bench_record_stack();
+    return 0;
+}
+
+static int buffered_sink(const char *message, ...)
+{
+    static char buffer[256];
+    int written;
+    va_list args;
+
+    va_start(args, message);
+    written = vsnprintf(buffer, sizeof(buffer), message, args);
+    va_end(args);
+
+    bench_record_stack();
+    return written;
+}
+
+static int formatter_sink(const char *message, ...)
+{
+    static char buffer[256];
+    int written;
+    va_list args;
+
+    va_start(args, message);
+    written = Logging_FormatV(buffer, sizeof(buffer), message, args);
+    va_end(args);
+
+    bench_record_stack();
+    return written;
+}
+
+static int stdout_sink(const char *message, ...)
+{
+    int written;
+    va_list args;
+
+    va_start(args, message);
+    written = vprintf(message, args);
+    va_end(args);
+
+    bench_record_stack();
+    return written;
+}
+
+typedef struct
+{
+    const char *name;
+    Logging_Function_t function;
+} Bench_Sink_t;
+
+static const Bench_Sink_t sinks[] = {
+    { "null", null_sink },
+    { "buffered", buffered_sink },
+    { "formatter", formatter_sink },
+    { "stdout", stdout_sink },
+};
+
+/* %f / %F edge cases: exact ties, values just off a tie, carries, signed zero, tiny and huge values, inf / nan */
+static const double check_values[] = {
+    0.0, -0.0, 0.05, 0.15, 0.25, 0.35, 0.5, 1.5, 2.5, -2.5, 0.125, 2.675, 1.005, 1.0 / 3.0,
+    0.9999999995, 9.9999999995, 99.95, 123456.7890125, 4294967296.5, 1e15 + 0.3, 9007199254740993.0,
+    18446744073709549568.0, 5e-10, 4.9999999e-10, 1e-10, -1e-7, 5e-324, INFINITY, -INFINITY, NAN,
+};
+
+static const char *const check_formats[] = {
+    "%f", "%.0f", "%.1f", "%.2f", "%.3f", "%.9f", "%+.3f", "% .1f", "%08.2f", "%-10.1f|", "%#.0f",
+    "%F", "%.2F", "%+F", "%08.3F", "%-6F|",
+};
+
+/* Logging_Format() against the C library; returns the number of mismatches */
+static unsigned check_formatter(void)
+{
+    unsigned mismatches = 0;
+    size_t v;
+    size_t f;
+
+    for (v = 0; v < sizeof(check_values) / sizeof(check_values[0]); v++)
+    {
+        for (f = 0; f < sizeof(check_formats) / sizeof(check_formats[0]); f++)
+        {
+            char expected[64];
+            char actual[64];
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+            (void)snprintf(expected, sizeof(expected), check_formats[f], check_values[v]);
+            (void)Logging_Format(actual, sizeof(actual), check_formats[f], check_values[v]);
+#pragma GCC diagnostic pop
+
+            if (strcmp(expected, actual) != 0)
+            {
+                fprintf(stderr, "formatter mismatch: \"%s\" of %.17g: \"%s\", libc \"%s\"\n",
+                        check_formats[f], check_values[v], actual, expected);
+                mismatches++;
+            }
+        }
+    }
+
+    fprintf(stderr, "Formatter check: %zu cases, %u mismatches\n",
+            (sizeof(check_values) / sizeof(check_values[0])) * (sizeof(check_formats) / sizeof(check_formats[0])),
+            mismatches);
+    return mismatches;
+}
+
+static double now_ns(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((double)now.tv_sec * 1e9) + (double)now.tv_nsec;
+}
+
+int main(int argc, char **argv)
+{
+    unsigned iterations = (argc > 1) ? (unsigned)strtoul(argv[1], NULL, 0) : 20000u;
+    double calls = (double)iterations * BENCH_CALLS_PER_ITERATION;
+    size_t v;
+    size_t s;
+
+    if (iterations == 0u)
+    {
+        fprintf(stderr, "usage: %s [iterations]\n", argv[0]);
+        return 1;
+    }
+
+    if (check_formatter() != 0u)
+    {
+        return 1;
+    }
+
+    fprintf(stderr, "Logging library %s, %u iterations x %d calls\n",
+            Logging_GetVersion(), iterations, BENCH_CALLS_PER_ITERATION);
+    fprintf(stderr, "%-28s %-9s %10s %12s %8s\n", "configuration", "sink", "ns/call",
+            BENCH_HAS_CYCLES ? "cycles/call" : "", "stack");
+
+    for (v = 0; v < sizeof(variants) / sizeof(variants[0]); v++)
+    {
+        for (s = 0; s < sizeof(sinks) / sizeof(sinks[0]); s++)
+        {
+            double start;
+            double elapsed;
+            unsigned long long cycles;
+
+            Logging_Init(sinks[s].function);
+            bench_stack_depth = 0;
+
+            variants[v].run(iterations / 10u + 1u); /* Warm-up */
+            fflush(stdout);
+
+            cycles = BENCH_CYCLES();
+            start = now_ns();
+            variants[v].run(iterations);
+            elapsed = now_ns() - start;
+            cycles = BENCH_CYCLES() - cycles;
+            fflush(stdout);
+
+            fprintf(stderr, "%-28s %-9s %10.1f", variants[v].name, sinks[s].name, elapsed / calls);
+            if (BENCH_HAS_CYCLES)
+            {
+                fprintf(stderr, " %12.1f", (double)cycles / calls);
+            }
+            else
+            {
+                fprintf(stderr, " %12s", "");
+            }
+            fprintf(stderr, " %8zu\n", bench_stack_depth);
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,39 @@
+/**
+ * @file: bench_sites.c
+ * @author: Paweł Kawula (pawel.kawula@kelectronics.pl)
+ * @brief: Benchmark call sites, compiled once per configuration
+ * -----
+ * Copyright 2025 - KElectronics
+ * -----
+ * @note: BENCH_ENTRY names the workload function of the configuration,
+ *        logging options come from the variant compile definitions.
+ */
+
+#include "bench.h"
+#include "logging.h"
+
+#ifndef BENCH_ENTRY
+#error "BENCH_ENTRY must name the workload function of this configuration."
+#endif
+
+void BENCH_ENTRY(unsigned iterations);
+
+void BENCH_ENTRY(unsigned iterations)
+{
+    unsigned i;
+
+    bench_site_frame = __builtin_frame_address(0);
+
+    for (i = 0; i < iterations; i++)
+    {
+        /* Typical mix: every level, with and without arguments */
+        LogError("Failed to initialize component");
+        LogError("Failed to initialize component %d", (int)i);
+        LogWarn("Buffer usage at %u%% capacity", i & 0x7Fu);
+        LogWarn("Retry %u of %u", i & 3u, 3u);
+        LogInfo("System initialized successfully");
+        LogInfo("Connected to %s on port %d", "gateway", 1883);
+        LogDebug("Processing packet: size=%u, type=0x%02X", i & 0xFFFu, i & 0xFFu);
+        LogDebug("State %d -> %d (%s)", (int)(i & 7u), (int)((i + 1u) & 7u), "transition");
+    }
+}
@@ -0,0 +1,69 @@
+#!/usr/bin/env python3
+"""Code size of the logging benchmark call sites per configuration.
+
+Usage: size_report.py <object>...
+
+Prints .text and .rodata bytes (all sub-sections, e.g. .text.*, .rodata.str1.1)
+of every object file. Objects are named after their configuration:
+<target>.dir/bench_sites.c.o inside the build tree.
+"""
+
+import os
+import re
+import struct
+import sys
+
+
+def section_sizes(path: str) -> dict:
+    """Return {section name: size}, minimal ELF parser (32/64 bit, any endianness)."""
+    with open(path, "rb") as elf:
+        image = elf.read()
+
+    if image[:4] != b"\x7fELF":
+        raise SystemExit(f"{path}: not an ELF file")
+
+    is_64 = image[4] == 2
+    endian = "<" if image[5] == 1 else ">"
+
+    if is_64:
+        shoff, = struct.unpack_from(endian + "Q", image, 0x28)
+        shentsize, shnum, shstrndx = struct.unpack_from(endian + "HHH", image, 0x3A)
+        header = endian + "IIQQQQIIQQ"
+    else:
+        shoff, = struct.unpack_from(endian + "I", image, 0x20)
+        shentsize, shnum, shstrndx = struct.unpack_from(endian + "HHH", image, 0x2E)
+        header = endian + "IIIIIIIIII"
+
+    sections = [struct.unpack_from(header, image, shoff + i * shentsize) for i in range(shnum)]
+    names_offset = sections[shstrndx][4]
+
+    sizes = {}
+    for section in sections:
+        start = names_offset + section[0]
+        sizes[image[start:image.index(b"\0", start)].decode()] = section[5]
+    return sizes
+
+
+def total(sizes: dict, prefix: str) -> int:
+    return sum(size for name, size in sizes.items() if name == prefix or name.startswith(prefix + "."))
+
+
+def configuration(path: str) -> str:
+    match = re.search(r"logging_bench_(\w+)\.dir", path)
+    return match.group(1) if match else os.path.basename(path)
+
+
+def main():
+    if len(sys.argv) < 2:
+        raise SystemExit(__doc__)
+
+    print(f"{'configuration':<28} {'.text':>8} {'.rodata':>8} {'total':>8}")
+    for path in sys.argv[1:]:
+        sizes = section_sizes(path)
+        text = total(sizes, ".text")
+        rodata = total(sizes, ".rodata")
+        print(f"{configuration(path):<28} {text:>8} {rodata:>8} {text + rodata:>8}")
+
+
+if __name__ == "__main__":
+    main()
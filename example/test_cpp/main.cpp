@@ -0,0 +1,146 @@
+// C++17 test application - same macros as the C example, through logging.hpp
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <ctime>
+#include <string>
+
+#include "logging.hpp"
+
+namespace
+{
+
+enum class LinkState : std::uint8_t
+{
+    Down,
+    Up,
+};
+
+// define logging function - receives the argument list directly, no va_start needed
+int console_vlog_function(const char *message, va_list args)
+{
+    std::printf("..C++ Log: ");
+    return std::vprintf(message, args);
+}
+
+#ifdef LOGGING_TOKENIZED
+// tokenized frames go to a file, decode with: logging_tokens.py decode test_cpp.tokens log_tokens_cpp.bin
+std::FILE *token_file;
+
+int token_write_function(const std::uint8_t *data, std::size_t length)
+{
+    return (int)std::fwrite(data, 1, length, token_file);
+}
+#endif
+
+#ifdef LOGGING_TRACE
+// trace events go to a file, convert with: logging_tokens.py trace test_cpp.tokens log_trace_cpp.bin
+std::FILE *trace_file;
+
+int trace_write_function(const std::uint8_t *data, std::size_t length)
+{
+    return (int)std::fwrite(data, 1, length, trace_file);
+}
+#endif
+
+#ifdef LOGGING_MULTI_SINK
+int stdout_sink(const std::uint8_t *data, std::size_t length)
+{
+    return (int)std::fwrite(data, 1, length, stdout);
+}
+#endif
+
+#ifdef LOGGING_DMA
+// stands in for a DMA transfer, completes synchronously
+void dma_start_function(const std::uint8_t *data, std::size_t length)
+{
+    std::fwrite(data, 1, length, stdout);
+    Logging_DmaComplete();
+}
+#endif
+
+} // namespace
+
+#ifdef LOGGING_TIMESTAMP
+// clock hook read at every log site (LOGGING_TIMESTAMP_SOURCE() not overridden)
+Logging_Timestamp_t Logging_GetTimestamp(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (Logging_Timestamp_t)((now.tv_sec * 1000000L) + (now.tv_nsec / 1000L));
+}
+#endif
+
+#ifdef LOGGING_DEFERRED_PER_CORE
+// ring selector hook, this example logs from a single thread
+unsigned Logging_GetCoreId(void)
+{
+    return 0;
+}
+#endif
+
+#if defined(LOGGING_RATE_LIMIT) ||                                                      \
+    (defined(LOGGING_DEFERRED) && (LOGGING_DEFERRED_OVERFLOW == LOGGING_OVERFLOW_BLOCK)) || \
+    (defined(LOGGING_BATCH) && (LOGGING_BATCH_FLUSH_INTERVAL_MS > 0))
+// default clock hook of the rate limiter, the blocking deferred ring and the batch flush interval
+uint32_t Logging_GetMilliseconds(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint32_t)((now.tv_sec * 1000L) + (now.tv_nsec / 1000000L));
+}
+#endif
+
+int main()
+{
+    Logging_InitV(console_vlog_function);
+#ifdef LOGGING_DMA
+    Logging_InitDma(dma_start_function);
+#endif
+#ifdef LOGGING_MULTI_SINK
+    Logging_AddSink(stdout_sink, LOGGING_ALL_LEVELS);
+#endif
+#ifdef LOGGING_TOKENIZED
+    token_file = std::fopen("log_tokens_cpp.bin", "wb");
+    Logging_InitTokenized(token_file ? token_write_function : nullptr);
+#endif
+#ifdef LOGGING_TRACE
+    trace_file = std::fopen("log_trace_cpp.bin", "wb");
+    Logging_InitTrace(trace_file ? trace_write_function : nullptr);
+#endif
+
+    const LinkState state = LinkState::Up;
+    const std::uint64_t uptime = 123456789012ull;
+
+    LogInfo("C++ front end, link state %u", state);   // enum class passed as its underlying type
+    LogWarn("Uptime %llu us", (unsigned long long)uptime);
+    LogError("Error code %d at %p", -5, static_cast<const void *>(&state));
+#ifndef LOGGING_DEFERRED /* Deferred records hold integer/pointer words only */
+    const std::string interface_name = "eth0";
+    LogDebug("Interface %s, load %f", interface_name, 0.25f);   // std::string as c_str(), float as double
+#endif
+    {
+        LogTraceScope("cpp_scope");   // RAII object, end event when the block is left
+        LogDebug("Compile-time prefix, no arguments");
+    }
+    (void)state;   // unused when logging is compiled out
+    (void)uptime;
+
+    Logging_Flush();
+
+#ifdef LOGGING_TOKENIZED
+    if (token_file)
+    {
+        std::fclose(token_file);
+    }
+#endif
+#ifdef LOGGING_TRACE
+    Logging_InitTrace(nullptr);
+    if (trace_file)
+    {
+        std::fclose(trace_file);
+    }
+#endif
+
+    return 0;
+}
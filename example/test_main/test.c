@@ -3,25 +3,182 @@
 
 #include <stdio.h>
 #include <string.h>
+#include <time.h>
 
 #include "logging.h"
 #include "module.h"
 
-// define logging function
-static int custom_log_function(const char *message, ...)
+// define logging function - receives the argument list directly, no va_start needed
+static int custom_vlog_function(const char *message, va_list args)
 {
-    va_list args;
-    va_start(args, message);
+#ifdef LOGGING_PERSIST
+    // keep a copy in retained RAM
+    char line[LOGGING_PERSIST_RECORD_SIZE];
+    va_list copy;
+    va_copy(copy, args);
+    int length = Logging_FormatV(line, sizeof(line), message, copy);
+    va_end(copy);
+    Logging_PersistWrite((const uint8_t *)line, (length < (int)sizeof(line)) ? (size_t)length : sizeof(line) - 1);
+#endif
     printf("..Main Log: ");
-    vprintf(message, args);
-    
-    va_end(args);
+    return vprintf(message, args);
+}
+
+#ifdef LOGGING_TOKENIZED
+// tokenized frames go to a file, decode with: logging_tokens.py decode test_main.tokens log_tokens.bin
+static FILE *token_file;
+
+static int token_write_function(const uint8_t *data, size_t length)
+{
+    return (int)fwrite(data, 1, length, token_file);
+}
+#endif
+
+#ifdef LOGGING_KV
+// structured records go to a file, convert with: logging_kv_json log_kv.bin
+static FILE *kv_file;
+
+static int kv_write_function(const uint8_t *data, size_t length)
+{
+    return (int)fwrite(data, 1, length, kv_file);
+}
+#endif
+
+#ifdef LOGGING_TRACE
+// trace events go to a file, convert with: logging_tokens.py trace test_main.tokens log_trace.bin -o trace.json
+static FILE *trace_file;
+
+static int trace_write_function(const uint8_t *data, size_t length)
+{
+    return (int)fwrite(data, 1, length, trace_file);
+}
+#endif
+
+#ifdef LOGGING_COMPRESS
+// compressed blocks go to a file, restore with: logging_unpack.py log_compressed.bin
+static FILE *compress_file;
+
+static int compress_write_function(const uint8_t *data, size_t length)
+{
+    return (int)fwrite(data, 1, length, compress_file);
+}
+#endif
+
+#ifdef LOGGING_TIMESTAMP
+// clock hook read at every log site (LOGGING_TIMESTAMP_SOURCE() not overridden)
+Logging_Timestamp_t Logging_GetTimestamp(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (Logging_Timestamp_t)((now.tv_sec * 1000000L) + (now.tv_nsec / 1000L));
+}
+#endif
+
+#ifdef LOGGING_DEFERRED_PER_CORE
+// ring selector hook, this example logs from a single thread
+unsigned Logging_GetCoreId(void)
+{
     return 0;
 }
+#endif
+
+#if defined(LOGGING_RATE_LIMIT) ||                                                      \
+    (defined(LOGGING_DEFERRED) && (LOGGING_DEFERRED_OVERFLOW == LOGGING_OVERFLOW_BLOCK)) || \
+    (defined(LOGGING_BATCH) && (LOGGING_BATCH_FLUSH_INTERVAL_MS > 0))
+// default clock hook of the rate limiter, the blocking deferred ring and the batch flush interval
+uint32_t Logging_GetMilliseconds(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint32_t)((now.tv_sec * 1000L) + (now.tv_nsec / 1000000L));
+}
+#endif
+
+#ifdef LOGGING_MULTI_SINK
+// formatted once by the library, delivered according to the level masks
+static int stdout_sink(const uint8_t *data, size_t length)
+{
+    return (int)fwrite(data, 1, length, stdout);
+}
+
+static int error_sink(const uint8_t *data, size_t length)
+{
+    fputs("..Errors only: ", stdout);
+    return (int)fwrite(data, 1, length, stdout);
+}
+#endif
+
+#ifdef LOGGING_DMA
+// stands in for a DMA transfer, completes synchronously
+static void dma_start_function(const uint8_t *data, size_t length)
+{
+    printf("DMA transfer (%zu bytes):\n", length);
+    fwrite(data, 1, length, stdout);
+    Logging_DmaComplete();
+}
+#endif
+
+#ifdef LOGGING_PANIC
+// polled output of the panic path, stands in for a UART written register by register
+static int panic_write_function(const uint8_t *data, size_t length)
+{
+    return (int)fwrite(data, 1, length, stdout);
+}
+#endif
+
+#if defined(LOGGING_BATCH) && !defined(LOGGING_COMPRESS)
+// stands in for one USB/UDP packet per batch
+static int batch_function(const Logging_Span_t *records, size_t count)
+{
+    printf("Batch of %zu records (%zu bytes):\n", count, Logging_BatchLength(records, count));
+    return (int)fwrite(records[0].data, 1, Logging_BatchLength(records, count), stdout);
+}
+#endif
+
+// each scope records a begin event here and an end event when the block is left
+static void traced_work(void)
+{
+    LogTraceScope("traced_work");
+    for (int i = 0; i < 3; i++)
+    {
+        LogTraceScope("step");
+        LogDebug("Traced step %d", i);
+    }
+}
 
 int main(void)
 {
-    Logging_Init(custom_log_function);
+    Logging_InitV(custom_vlog_function);
+#ifdef LOGGING_DMA
+    Logging_InitDma(dma_start_function);
+#endif
+#ifdef LOGGING_COMPRESS
+    compress_file = fopen("log_compressed.bin", "wb");
+    Logging_InitCompress(compress_file ? compress_write_function : NULL);
+#ifdef LOGGING_BATCH
+    Logging_InitBatch(Logging_CompressBatch); // one block per batch
+#else
+    Logging_InitWrite(Logging_CompressWrite); // one block per line, history shared
+#endif
+#elif defined(LOGGING_BATCH)
+    Logging_InitBatch(batch_function);
+#endif
+#ifdef LOGGING_MULTI_SINK
+    Logging_AddSink(stdout_sink, LOGGING_ALL_LEVELS);
+    Logging_AddSink(error_sink, LOGGING_LEVEL_MASK(LOG_ERROR));
+#endif
+#ifdef LOGGING_TOKENIZED
+    token_file = fopen("log_tokens.bin", "wb");
+    Logging_InitTokenized(token_file ? token_write_function : NULL);
+#endif
+#ifdef LOGGING_KV
+    kv_file = fopen("log_kv.bin", "wb");
+    Logging_InitKV(kv_file ? kv_write_function : NULL);
+#endif
+#ifdef LOGGING_TRACE
+    trace_file = fopen("log_trace.bin", "wb");
+    Logging_InitTrace(trace_file ? trace_write_function : NULL);
+#endif
 
     printf("Logging Library Version: %s\n", Logging_GetVersion());
     printf("Top logging level: %s\n", Logging_GetLoggingLevelName(Logging_GetTopLoggingLevel()));
@@ -31,10 +188,105 @@ int main(void)
     LogError("This is an error message");
     LogWarn("This is a warning message with some details %s", "additional info");
     LogDebug("This is a debug message with int: %d", 42);
+#ifndef LOGGING_DEFERRED /* Deferred records hold integer/pointer words only */
     LogDebug("This is a debug message with float: %f", 3.14);
+#endif
     LogDebug("This is a debug message with hex: 0x%x", 0xDEADBEEF);
 
+#ifndef LOGGING_DEFERRED /* Hex dumps are formatted at the call site */
+    static const uint8_t frame[] = { 0x7E, 0x01, 0x10, 0xA5, 0x5A, 0xDE, 0xAD, 0xBE, 0xEF, 0x7E };
+    LogDebugHex(frame, sizeof(frame));
+    (void)frame;   // unused when the debug level is compiled out
+#endif
+    LogWarnIf(sizeof(long) > 4, "long is %u bytes on this host", (unsigned)sizeof(long));   // cond is checked after the level
+
+#ifdef LOGGING_KV
+    LogInfoKV("boot");
+    LogInfoKV("rx", KV_U32("len", 42), KV_STR("port", "uart1"), KV_BOOL("crc_ok", 1));
+    LogWarnKV("temperature", KV_F32("celsius", 71.5f), KV_I32("delta", -3));
+#endif
+
+#ifdef LOGGING_RATE_LIMIT
+    for (int i = 0; i < 25; i++)
+    {
+        LogWarn("Flooding call site, iteration %d", i);   // Only the first burst is printed
+    }
+#endif
+
+    traced_work();
+
+#ifdef LOGGING_SITES
+    // every call site can be listed and switched, e.g. from a debug console
+    for (size_t id = 0; id < Logging_GetSiteCount(); id++)
+    {
+        const Logging_Site_t *site = Logging_GetSite(id);
+        printf("site %zu: %s:%u %s %s\n", id, site->file, (unsigned)site->line,
+               Logging_GetLoggingLevelName(site->level), site->enabled ? "on" : "off");
+    }
+    Logging_SetSitesEnabled("test.c", 0, 0);
+    LogError("Not printed, every site of test.c is switched off");
+    Logging_SetSitesEnabled("test.c", 0, 1);
+#endif
+
+    Logging_Flush();
+
+#ifdef LOGGING_RUNTIME_FILTER
+    /* Module keeps its compiled-in messages, but only WARN and above are printed */
+    Logging_SetModuleLevel("TEST_MODULE", LOG_WARN);
+#endif
+
     testfunction();
 
+    Logging_Flush();
+#ifdef LOGGING_BATCH
+    Logging_BatchFlush(); // partial batch still waiting for LOGGING_BATCH_FLUSH_INTERVAL_MS
+#endif
+
+#ifdef LOGGING_STATS
+    Logging_Stats_t stats[4];
+    size_t modules = Logging_GetStats(stats, 4);
+    for (size_t i = 0; (i < modules) && (i < 4); i++)
+    {
+        printf("Module \"%s\" (id %u): emitted E%lu W%lu I%lu D%lu, dropped %lu\n", stats[i].name, (unsigned)stats[i].id,
+               (unsigned long)stats[i].emitted[0], (unsigned long)stats[i].emitted[1],
+               (unsigned long)stats[i].emitted[2], (unsigned long)stats[i].emitted[3],
+               (unsigned long)(stats[i].dropped[0] + stats[i].dropped[1] + stats[i].dropped[2] + stats[i].dropped[3]));
+    }
+#endif
+
+#ifdef LOGGING_PERSIST
+    // what the next boot would replay after a fault (module logs use their own sink)
+    Logging_InitV(custom_vlog_function);
+    printf("Retained messages:\n");
+    printf("%zu replayed\n", Logging_RecoverPersisted());
+#endif
+
+#ifdef LOGGING_PANIC
+    // last words before a reset: the buffered warning and the error are written before the calls return
+    LogWarn("Still buffered when the fault hits");
+    Logging_EnterPanic(panic_write_function);
+    LogError("Fatal error, panic mode %d", Logging_InPanic());
+#endif
+
+#ifdef LOGGING_KV
+    if (kv_file)
+    {
+        fclose(kv_file);
+    }
+#endif
+#ifdef LOGGING_COMPRESS
+    if (compress_file)
+    {
+        fclose(compress_file);
+    }
+#endif
+#ifdef LOGGING_TRACE
+    Logging_InitTrace(NULL);
+    if (trace_file)
+    {
+        fclose(trace_file);
+    }
+#endif
+
     return 0;
 }
\ No newline at end of file
@@ -28,7 +28,9 @@ void testfunction(void)
     LogError("This is an error message");
     LogWarn("This is a warning message with some details %s", "additional info");
     LogDebug("This is a debug message with int: %d", 42);
+#ifndef LOGGING_DEFERRED /* Deferred records hold integer/pointer words only */
     LogDebug("This is a debug message with float: %f", 3.14);
+#endif
     LogDebug("This is a debug message with hex: 0x%x", 0xDEAD);
 
 }
\ No newline at end of file
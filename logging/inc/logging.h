@@ -13,19 +13,35 @@
 
 #include "logging_levels.h"
 #include "logging_stack.h"
+#include "logging_batch.h"
+#include "logging_compress.h"
+#include "logging_dma.h"
+#include "logging_hex.h"
+#include "logging_kv.h"
+#include "logging_panic.h"
+#include "logging_persist.h"
+#include "logging_sinks.h"
+#include "logging_trace.h"
 
 /* Version is automatically defined by CMake from project(logging VERSION x.y.z) */
 #ifndef LOGGING_VERSION
 #define LOGGING_VERSION "unknown"
 #endif
 
+/**
+ * @brief Stack buffer a message is formatted into for Logging_InitWrite() outputs.
+ *
+ * Longer messages are truncated, keeping the trailing "\r\n".
+ */
+#ifndef LOGGING_WRITE_BUFFER_SIZE
+#define LOGGING_WRITE_BUFFER_SIZE 128
+#endif
+
 #ifdef __cplusplus
 extern "C"
 {
 #endif
 
-typedef int (*Logging_Function_t)(const char *message, ...);
-
 /**
  * @brief Initialize the logging system with a custom logging function.
  * 
@@ -35,7 +51,9 @@ typedef int (*Logging_Function_t)(const char *message, ...);
  * @param log_func Pointer to the custom logging function that handles output.
  *                 Pass NULL to use a default no-op function (disables logging).
  * 
- * @note Must be called before using any logging macros (LogError, LogWarn, etc.).
+ * @note Messages logged before the first initialization go to a no-op function.
+ *       The function pointer is published with release semantics, so it is
+ *       safe to call while other tasks are logging.
  * 
  * @example
  * @code
@@ -55,6 +73,132 @@ typedef int (*Logging_Function_t)(const char *message, ...);
  */
 void Logging_Init(Logging_Function_t log_func);
 
+/**
+ * @brief Atomically replace the logging function and return the previous one.
+ * 
+ * For hot-swapping outputs while other tasks keep logging (e.g. switch to a
+ * USB CDC sink when the host attaches, back to UART when it leaves). Every
+ * log call sees either the old or the new function, never a torn value.
+ * The new function must be ready to run before the call (release ordering).
+ * 
+ * @param log_func New logging function, NULL installs the default no-op function.
+ * @return Logging_Function_t Function active before the swap (the no-op
+ *         function before any initialization, never NULL).
+ * 
+ * @note A caller that was already inside the previous function may still be
+ *       running it when this returns - keep the old output usable until such
+ *       calls have finished.
+ * 
+ * @example
+ * @code
+ * static Logging_Function_t uart_sink;
+ * 
+ * void usb_host_attached(void) {
+ *     uart_sink = Logging_SwapSink(usb_cdc_logger);
+ * }
+ * 
+ * void usb_host_detached(void) {
+ *     (void)Logging_SwapSink(uart_sink);
+ * }
+ * @endcode
+ */
+Logging_Function_t Logging_SwapSink(Logging_Function_t log_func);
+
+/**
+ * @brief Initialize the logging system with a va_list logging function.
+ * 
+ * Alternative to Logging_Init() for sinks and middleware working on va_list
+ * (vprintf, vsnprintf, RTOS trace calls). Log macros enter the library once
+ * through a single internal entry point that starts the argument list and
+ * calls Logging_VLog(); the registered function receives the list directly
+ * instead of re-packing the arguments.
+ * 
+ * @param vlog_func Pointer to the va_list logging function.
+ *                  Pass NULL to use a default no-op function (disables logging).
+ * 
+ * @note Replaces the function registered by Logging_Init() and vice versa.
+ * 
+ * @example
+ * @code
+ * static int uart_vlogger(const char *message, va_list args) {
+ *     return uart_vprintf(message, args);
+ * }
+ * 
+ * // Middleware: prefix with a tick count, then pass the same list on
+ * static int tick_vlogger(const char *message, va_list args) {
+ *     uart_printf("%lu ", xTaskGetTickCount());
+ *     return uart_vlogger(message, args);
+ * }
+ * 
+ * int main(void) {
+ *     Logging_InitV(tick_vlogger);
+ *     LogInfo("System initialized successfully");
+ * }
+ * @endcode
+ */
+void Logging_InitV(Logging_VFunction_t vlog_func);
+
+/**
+ * @brief Initialize the logging system with a byte output function.
+ * 
+ * The library formats every message itself with Logging_FormatV() into a
+ * LOGGING_WRITE_BUFFER_SIZE stack buffer and hands the bytes to write_func.
+ * No printf family function is involved, so libc printf does not have to be
+ * linked, and formatting is reentrant (each caller uses its own stack buffer).
+ * 
+ * @param write_func Function receiving the formatted message (NUL terminated, length without NUL).
+ *                   Pass NULL to use a default no-op function (disables logging).
+ * 
+ * @note Replaces the function registered by Logging_Init() / Logging_InitV() and vice versa.
+ * 
+ * @example
+ * @code
+ * static int uart_write(const uint8_t *data, size_t length) {
+ *     return HAL_UART_Transmit(&huart2, data, length, 10);
+ * }
+ * 
+ * int main(void) {
+ *     Logging_InitWrite(uart_write);
+ *     LogInfo("Voltage %d.%02u V", volts, centivolts);
+ * }
+ * @endcode
+ */
+void Logging_InitWrite(Logging_WriteFunction_t write_func);
+
+/**
+ * @brief Pass a message with an already started argument list to the registered va_list function.
+ * 
+ * Single entry point of the va_list path, also usable by code that wraps
+ * its own variadic API around the logging system.
+ * 
+ * @param message printf-style format string.
+ * @param args    Argument list for the format string.
+ * @return int Value returned by the registered function, 0 when none is registered
+ *             with Logging_InitV().
+ */
+int Logging_VLog(const char *message, va_list args) LOGGING_PRINTF_FORMAT(1, 0);
+
+/**
+ * @brief Drain all buffered log records through the registered logging function.
+ * 
+ * In LOGGING_DEFERRED mode pushes every pending record from the ring buffer
+ * to the function passed to Logging_Init(). With LOGGING_BATCH the partial
+ * batch is delivered afterwards (once due, see LOGGING_BATCH_FLUSH_INTERVAL_MS). Must be called from a single context (e.g.
+ * a low-priority logging task). Does nothing when no buffered backend is
+ * enabled, so it can be called unconditionally.
+ * 
+ * @example
+ * @code
+ * void logging_task(void *arg) {
+ *     for (;;) {
+ *         Logging_Flush();
+ *         vTaskDelay(pdMS_TO_TICKS(10));
+ *     }
+ * }
+ * @endcode
+ */
+void Logging_Flush(void);
+
 /**
  * @brief Get the version of the logging library.
  * 
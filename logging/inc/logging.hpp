@@ -0,0 +1,453 @@
+/**
+ * @file: logging.hpp
+ * @author: Paweł Kawula (pawel.kawula@kelectronics.pl)
+ * @brief: C++17 front end - constexpr message prefix and typed argument encoders
+ * -----
+ * Copyright 2025 - KElectronics
+ * -----
+ * @note: Include instead of logging.h in C++ translation units. The LogX()
+ *        macros, levels and options stay the same, only LOG_WITH_FUNC is
+ *        replaced: the complete format ("[INFO]  [NAME] (func):42 - ...\r\n")
+ *        is built as a constexpr std::array<char>, and every argument is
+ *        forwarded by its own type to the encoder of the output mode instead
+ *        of going through C varargs promotion:
+ *        - direct: enums are passed as their underlying type, std::string
+ *          as c_str(), the sink is called as before
+ *        - LOGGING_DEFERRED: argument words are stored per type, floating
+ *          point and std::string arguments are rejected at compile time
+ *        - LOGGING_TOKENIZED: token and argument descriptor are constants
+ *          computed from the std::array and the template parameter types,
+ *          the same values the C macros produce (same dictionary and decoder)
+ *        Format strings are checked with -Wformat like in C. LogTraceScope()
+ *        (LOGGING_TRACE) is an RAII object instead of a cleanup attribute.
+ */
+
+#ifndef LOGGING_HPP
+#define LOGGING_HPP
+
+#if !defined(__cplusplus) || (__cplusplus < 201703L)
+#error "logging.hpp requires C++17 or later."
+#endif
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#if (__cplusplus >= 202002L) && defined(__has_include)
+#if __has_include(<source_location>)
+#include <source_location>
+#define LOGGING_HAS_SOURCE_LOCATION
+#endif
+#endif
+
+#include "logging.h"
+
+namespace logging
+{
+namespace detail
+{
+
+template <typename T>
+using Bare = std::remove_cv_t<std::remove_reference_t<T>>;
+
+template <typename T>
+constexpr bool always_false = false;
+
+/**
+ * @brief NUL terminated character sequence usable in constant expressions.
+ *
+ * @tparam N Number of characters including the terminating NUL.
+ */
+template <std::size_t N>
+struct Literal
+{
+    std::array<char, N> chars;
+
+    constexpr const char *c_str() const
+    {
+        return chars.data();
+    }
+};
+
+template <std::size_t N>
+constexpr Literal<N> literal(const char (&text)[N])
+{
+    Literal<N> result{};
+    for (std::size_t i = 0; i < N; i++)
+    {
+        result.chars[i] = text[i];
+    }
+    return result;
+}
+
+template <std::size_t A, std::size_t B>
+constexpr Literal<A + B - 1u> operator+(const Literal<A> &left, const Literal<B> &right)
+{
+    Literal<A + B - 1u> result{};
+    for (std::size_t i = 0; i < (A - 1u); i++)
+    {
+        result.chars[i] = left.chars[i];
+    }
+    for (std::size_t i = 0; i < B; i++)
+    {
+        result.chars[(A - 1u) + i] = right.chars[i];
+    }
+    return result;
+}
+
+constexpr std::size_t digits(unsigned long value)
+{
+    return (value < 10u) ? 1u : (1u + digits(value / 10u));
+}
+
+/* Decimal rendering of a constant, decimal<__LINE__>() */
+template <unsigned long Value>
+constexpr Literal<digits(Value) + 1u> decimal()
+{
+    Literal<digits(Value) + 1u> result{};
+    unsigned long rest = Value;
+    for (std::size_t i = digits(Value); i > 0u; i--)
+    {
+        result.chars[i - 1u] = (char)('0' + (rest % 10u));
+        rest /= 10u;
+    }
+    return result;
+}
+
+/* Same 65599 hash as LOGGING_TOKEN_HASH() and tools/logging_tokens.py */
+template <std::size_t N>
+constexpr std::uint32_t token_hash(const Literal<N> &text)
+{
+    std::uint32_t value = (std::uint32_t)(N - 1u);
+    std::uint32_t coefficient = 65599u;
+    for (std::size_t i = 0; (i < (N - 1u)) && (i < 128u); i++)
+    {
+        value += (std::uint32_t)(unsigned char)text.chars[i] * coefficient;
+        coefficient *= 65599u;
+    }
+    return value;
+}
+
+#ifdef LOGGING_TOKENIZED
+static_assert(LOGGING_TOKEN_HASH_LENGTH == 128, "token_hash() covers 128 characters");
+#endif
+
+/* Argument as handed to the sink: enums as their underlying type, strings as const char * */
+inline const char *pass(const std::string &text)
+{
+    return text.c_str();
+}
+
+template <typename T>
+constexpr auto pass(const T &value)
+{
+    if constexpr (std::is_array_v<T>)
+    {
+        return &value[0];
+    }
+    else if constexpr (std::is_enum_v<T>)
+    {
+        return static_cast<std::underlying_type_t<T>>(value);
+    }
+    else if constexpr (std::is_null_pointer_v<T>)
+    {
+        return static_cast<const void *>(value);
+    }
+    else if constexpr (std::is_arithmetic_v<T> || std::is_pointer_v<T>)
+    {
+        return value;
+    }
+    else
+    {
+        static_assert(!std::is_same_v<T, std::string_view>,
+                      "std::string_view is not NUL terminated, log it with \"%.*s\", (int)view.size(), view.data()");
+        static_assert(std::is_same_v<T, std::string_view> || always_false<T>,
+                      "unsupported log argument type");
+        return 0;
+    }
+}
+
+/* LOGGING_ARG_* code of one argument, what LOGGING_ARG_TYPE() computes with C builtins */
+template <typename T>
+constexpr std::uint32_t arg_type()
+{
+    using Passed = Bare<decltype(pass(std::declval<const Bare<T> &>()))>;
+
+    if constexpr (std::is_same_v<Passed, const char *> || std::is_same_v<Passed, char *>)
+    {
+        return LOGGING_ARG_STRING;
+    }
+    else if constexpr (std::is_floating_point_v<Passed>)
+    {
+        return LOGGING_ARG_DOUBLE;
+    }
+    else if constexpr (std::is_pointer_v<Passed>)
+    {
+        return LOGGING_ARG_POINTER;
+    }
+    else
+    {
+        return (sizeof(Passed) > 4u) ? LOGGING_ARG_INT64 : LOGGING_ARG_INT32;
+    }
+}
+
+/* Descriptor in the LOGGING_ARG_TYPES() layout */
+template <typename... Args>
+constexpr std::uint32_t arg_types()
+{
+    constexpr std::uint32_t codes[] = { 0u, arg_type<Args>()... };
+    std::uint32_t types = (std::uint32_t)sizeof...(Args);
+    for (std::size_t i = 0; i < sizeof...(Args); i++)
+    {
+        types |= codes[i + 1u] << (4u + (3u * i));
+    }
+    return types;
+}
+
+/* Direct mode: the sink formats, arguments keep their types up to the varargs call */
+template <std::size_t N, typename... Args>
+inline void print(const Literal<N> &format, Args &&...args)
+{
+    LOGGING_CURRENT_SINK()(format.c_str(), pass(std::forward<Args>(args))...);
+}
+
+#ifdef LOGGING_TOKENIZED
+/* Exactly the type Logging_TokenLog() reads for the argument code */
+template <typename T>
+inline auto token_arg(const T &value)
+{
+    constexpr std::uint32_t type = arg_type<T>();
+    const auto passed = pass(value);
+
+    if constexpr (type == LOGGING_ARG_STRING)
+    {
+        return static_cast<const char *>(passed);
+    }
+    else if constexpr (type == LOGGING_ARG_DOUBLE)
+    {
+        return static_cast<double>(passed);
+    }
+    else if constexpr (type == LOGGING_ARG_POINTER)
+    {
+        return static_cast<const void *>(passed);
+    }
+    else if constexpr (type == LOGGING_ARG_INT64)
+    {
+        return static_cast<long long>(passed);
+    }
+    else
+    {
+        return static_cast<int>(passed);
+    }
+}
+
+template <std::uint32_t Token, std::size_t N, typename... Args>
+inline void tokenize(const Literal<N> &format, Args &&...args)
+{
+    constexpr std::uint32_t types = arg_types<Args...>();
+
+    static_assert(sizeof...(Args) <= 8u, "a tokenized message takes at most 8 arguments");
+    (void)format;
+    Logging_TokenLog(Token, types, token_arg(std::forward<Args>(args))...);
+}
+#endif /* LOGGING_TOKENIZED */
+
+#ifdef LOGGING_DEFERRED
+/* One record word, integers and pointers only */
+template <typename T>
+inline std::uintptr_t deferred_word(const T &value)
+{
+    constexpr std::uint32_t type = arg_type<T>();
+    const auto passed = pass(value);
+
+    static_assert(type != LOGGING_ARG_DOUBLE, "floating-point arguments are not supported in deferred mode");
+    static_assert(!std::is_same_v<Bare<T>, std::string>,
+                  "deferred records keep the string address, a std::string may be gone when the ring is processed");
+
+    if constexpr ((type == LOGGING_ARG_STRING) || (type == LOGGING_ARG_POINTER))
+    {
+        return reinterpret_cast<std::uintptr_t>(static_cast<const void *>(passed));
+    }
+    else
+    {
+        static_assert(sizeof(passed) <= sizeof(std::uintptr_t), "integer argument wider than a deferred word");
+        return static_cast<std::uintptr_t>(passed);
+    }
+}
+
+/* Fill and publish a record acquired by the call site (arguments are evaluated only then) */
+template <std::size_t N, typename... Args>
+inline void defer(Logging_DeferredRecord_t *record, const Literal<N> &format, Args &&...args)
+{
+    std::size_t index = 0u;
+
+    static_assert(sizeof...(Args) <= LOGGING_DEFERRED_MAX_ARGS, "too many arguments for a deferred record");
+    record->format = format.c_str();
+    record->arg_count = (std::uint8_t)sizeof...(Args);
+    ((record->args[index++] = deferred_word(std::forward<Args>(args))), ...);
+    (void)index;
+    Logging_DeferredCommit(record);
+}
+#endif /* LOGGING_DEFERRED */
+
+#ifdef LOGGING_KV
+/* Field list without a compound literal */
+template <typename... Fields>
+inline void kv_log(std::uint8_t level, std::uint16_t module, std::uint16_t line, const char *event,
+                   const Fields &...fields)
+{
+    const Logging_KVField_t list[] = { Logging_KVField_t{}, fields... };
+    Logging_KVLog(level, module, line, event, &list[1], sizeof...(Fields));
+}
+#endif /* LOGGING_KV */
+
+#if defined(LOGGING_TRACE) && defined(LOGGING_TIMESTAMP) && !defined(LOGGING_DISABLED_GLOBALLY)
+/* RAII scope: begin event in the constructor, end event in the destructor */
+class TraceScope
+{
+  public:
+    explicit TraceScope(std::uint32_t name) noexcept : name_(name)
+    {
+        Logging_TraceEvent(LOGGING_TRACE_BEGIN, name_, LOG_TIMESTAMP_NOW());
+    }
+
+    ~TraceScope()
+    {
+        Logging_TraceEvent(LOGGING_TRACE_END, name_, LOG_TIMESTAMP_NOW());
+    }
+
+    TraceScope(const TraceScope &) = delete;
+    TraceScope &operator=(const TraceScope &) = delete;
+
+  private:
+    std::uint32_t name_;
+};
+#endif /* LOGGING_TRACE */
+
+} // namespace detail
+} // namespace logging
+
+#if !defined(LOGGING_DISABLED_GLOBALLY)
+
+/* Function name: __func__, or the qualified signature with LOGGING_CPP_QUALIFIED_FUNCTION_NAME */
+#if defined(LOGGING_CPP_QUALIFIED_FUNCTION_NAME) && defined(LOGGING_HAS_SOURCE_LOCATION)
+#define LOGGING_CPP_FUNCTION_NAME std::source_location::current().function_name()
+#elif defined(LOGGING_CPP_QUALIFIED_FUNCTION_NAME)
+#define LOGGING_CPP_FUNCTION_NAME __PRETTY_FUNCTION__
+#else
+#define LOGGING_CPP_FUNCTION_NAME __func__
+#endif
+
+/* Same slots and leading arguments as the C LOG_WITH_FUNC variants */
+#if defined(LOGGING_TIMESTAMP)
+#define LOGGING_CPP_TIMESTAMP_SLOT LOG_TIMESTAMP_SLOT
+#define LOGGING_CPP_TIMESTAMP_ARG , LOG_TIMESTAMP_NOW()
+#else
+#define LOGGING_CPP_TIMESTAMP_SLOT ""
+#define LOGGING_CPP_TIMESTAMP_ARG
+#endif
+
+#if defined(LOGGING_PRINT_FUNCTION_NAME)
+#define LOGGING_CPP_FUNCTION_SLOT "(%s)"
+#define LOGGING_CPP_FUNCTION_ARG , LOGGING_CPP_FUNCTION_NAME
+#else
+#define LOGGING_CPP_FUNCTION_SLOT ""
+#define LOGGING_CPP_FUNCTION_ARG
+#endif
+
+#define LOGGING_CPP_LEADING_ARGS LOGGING_CPP_TIMESTAMP_ARG LOGGING_CPP_FUNCTION_ARG
+
+/* Format checking sees the arguments as the sink receives them (leading comma per argument) */
+#define LOGGING_CPP_PASS_0()
+#define LOGGING_CPP_PASS_1(a1) \
+    , ::logging::detail::pass(a1)
+#define LOGGING_CPP_PASS_2(a1, a2) \
+    LOGGING_CPP_PASS_1(a1), ::logging::detail::pass(a2)
+#define LOGGING_CPP_PASS_3(a1, a2, a3) \
+    LOGGING_CPP_PASS_2(a1, a2), ::logging::detail::pass(a3)
+#define LOGGING_CPP_PASS_4(a1, a2, a3, a4) \
+    LOGGING_CPP_PASS_3(a1, a2, a3), ::logging::detail::pass(a4)
+#define LOGGING_CPP_PASS_5(a1, a2, a3, a4, a5) \
+    LOGGING_CPP_PASS_4(a1, a2, a3, a4), ::logging::detail::pass(a5)
+#define LOGGING_CPP_PASS_6(a1, a2, a3, a4, a5, a6) \
+    LOGGING_CPP_PASS_5(a1, a2, a3, a4, a5), ::logging::detail::pass(a6)
+#define LOGGING_CPP_PASS_7(a1, a2, a3, a4, a5, a6, a7) \
+    LOGGING_CPP_PASS_6(a1, a2, a3, a4, a5, a6), ::logging::detail::pass(a7)
+#define LOGGING_CPP_PASS_8(a1, a2, a3, a4, a5, a6, a7, a8) \
+    LOGGING_CPP_PASS_7(a1, a2, a3, a4, a5, a6, a7), ::logging::detail::pass(a8)
+
+#define LOGGING_CPP_PASS(...) \
+    LOGGING_CONCAT(LOGGING_CPP_PASS_, LOGGING_NARGS(__VA_ARGS__))(__VA_ARGS__)
+
+#define LOGGING_CPP_CHECK_FORMAT(tag, message, ...)                                                   \
+    LOGGING_CHECK_FORMAT(tag LOGGING_CPP_TIMESTAMP_SLOT LOG_PREFIX LOGGING_CPP_FUNCTION_SLOT LOG_SUFFIX \
+                         message "\r\n" LOGGING_CPP_LEADING_ARGS LOGGING_CPP_PASS(__VA_ARGS__))
+
+/* std::array counterpart of the C literal concatenation */
+#define LOGGING_CPP_FORMAT(tag, message)                                                              \
+    (::logging::detail::literal(tag) + ::logging::detail::literal(LOGGING_CPP_TIMESTAMP_SLOT) +       \
+     ::logging::detail::literal(LOG_PREFIX) + ::logging::detail::literal(LOGGING_CPP_FUNCTION_SLOT) + \
+     ::logging::detail::literal(":") + ::logging::detail::decimal<__LINE__>() +                      \
+     ::logging::detail::literal(" - ") + ::logging::detail::literal(message) +                       \
+     ::logging::detail::literal("\r\n"))
+
+#undef LOG_WITH_FUNC
+
+#if defined(LOGGING_DEFERRED)
+#define LOG_WITH_FUNC(level, message, ...)                                                           \
+    do                                                                                               \
+    {                                                                                                \
+        LOGGING_CPP_CHECK_FORMAT(level, message, ##__VA_ARGS__);                                     \
+        static constexpr auto logging_format_ = LOGGING_CPP_FORMAT(level, message);                  \
+        Logging_DeferredRecord_t *logging_record_ =                                                  \
+            Logging_DeferredAcquire(static_cast<std::uint8_t>(LOGGING_TAG_LEVEL(level)));            \
+        if (logging_record_ != nullptr)                                                              \
+        {                                                                                            \
+            ::logging::detail::defer(logging_record_, logging_format_ LOGGING_CPP_LEADING_ARGS,      \
+                                     ##__VA_ARGS__);                                                 \
+        }                                                                                            \
+        else                                                                                         \
+        {                                                                                            \
+            LOGGING_STATS_DROPPED_TAG(level);                                                        \
+        }                                                                                            \
+    } while (0)
+#elif defined(LOGGING_TOKENIZED)
+#define LOG_WITH_FUNC(level, message, ...)                                                           \
+    do                                                                                               \
+    {                                                                                                \
+        LOGGING_CPP_CHECK_FORMAT(level, message, ##__VA_ARGS__);                                     \
+        static constexpr auto logging_format_ LOGGING_TOKEN_SECTION = LOGGING_CPP_FORMAT(level, message); \
+        ::logging::detail::tokenize<::logging::detail::token_hash(logging_format_)>(                 \
+            logging_format_ LOGGING_CPP_LEADING_ARGS, ##__VA_ARGS__);                                \
+    } while (0)
+#else
+#define LOG_WITH_FUNC(level, message, ...)                                                           \
+    do                                                                                               \
+    {                                                                                                \
+        LOGGING_CPP_CHECK_FORMAT(level, message, ##__VA_ARGS__);                                     \
+        static constexpr auto logging_format_ = LOGGING_CPP_FORMAT(level, message);                  \
+        ::logging::detail::print(logging_format_ LOGGING_CPP_LEADING_ARGS, ##__VA_ARGS__);           \
+    } while (0)
+#endif
+
+#if defined(LOGGING_KV)
+#undef LOGGING_KV_EMIT
+#define LOGGING_KV_EMIT(level, event, ...)                                                          \
+    ::logging::detail::kv_log((std::uint8_t)(level), (std::uint16_t)(LOGGING_MODULE_ID),            \
+                              (std::uint16_t)__LINE__, (event), ##__VA_ARGS__)
+#endif
+
+#if defined(LOGGING_TRACE) && defined(LOGGING_TIMESTAMP)
+#undef LOGGING_TRACE_SCOPE
+#define LOGGING_TRACE_SCOPE(name, id)                                                              \
+    static const char LOGGING_CONCAT(id, _name)[] LOGGING_TOKEN_SECTION = name;                    \
+    const ::logging::detail::TraceScope id(LOGGING_TOKEN_HASH(name))
+#endif
+
+#endif /* !LOGGING_DISABLED_GLOBALLY */
+
+#endif /* LOGGING_HPP */
@@ -0,0 +1,178 @@
+/**
+ * @file: logging_batch.h
+ * @author: Paweł Kawula (pawel.kawula@kelectronics.pl)
+ * @brief: Batching output stage - several records per call of the transport
+ * -----
+ * Copyright 2025 - KElectronics
+ * -----
+ * @note: Enabled with LOGGING_BATCH. Messages are formatted back to back into
+ *        one buffer and handed to the function registered with
+ *        Logging_InitBatch() as an array of records once the buffer or the
+ *        record table is full, or when Logging_Flush() is called. USB CDC
+ *        and network transports send a full packet instead of paying their
+ *        per-call overhead for every message. Call sites do not change.
+ */
+
+#ifndef LOGGING_BATCH_H
+#define LOGGING_BATCH_H
+
+#include <stddef.h>
+
+#include "logging_types.h"
+
+/**
+ * @brief Total number of bytes of a batch, records[0].data is its first byte.
+ *
+ * Independent of LOGGING_BATCH, for transports that also take batches from
+ * other sources.
+ */
+static inline size_t Logging_BatchLength(const Logging_Span_t *records, size_t count)
+{
+    return (count == 0u) ? 0u
+                         : (size_t)((records[count - 1u].data + records[count - 1u].length) - records[0].data);
+}
+
+#ifdef LOGGING_BATCH
+
+#include <stdint.h>
+
+#include "logging_levels.h"
+
+/**
+ * @brief Size of the batch buffer in bytes, the most one call delivers.
+ *
+ * E.g. the UDP payload of one Ethernet frame (1472) or a multiple of the
+ * USB endpoint size. A single message longer than the buffer is truncated,
+ * keeping the trailing "\r\n".
+ */
+#ifndef LOGGING_BATCH_BUFFER_SIZE
+#define LOGGING_BATCH_BUFFER_SIZE 512
+#endif
+
+/**
+ * @brief Most records delivered by one call.
+ */
+#ifndef LOGGING_BATCH_MAX_RECORDS
+#define LOGGING_BATCH_MAX_RECORDS 16
+#endif
+
+/**
+ * @brief Messages of this level or a more severe one deliver the batch at once.
+ *
+ * E.g. LOG_ERROR: an error leaves with the records before it instead of
+ * waiting for the batch to fill. LOG_NONE (default) never flushes by level.
+ * Byte records from Logging_BatchWrite() carry no level tag.
+ */
+#ifndef LOGGING_BATCH_FLUSH_LEVEL
+#define LOGGING_BATCH_FLUSH_LEVEL LOG_NONE
+#endif
+
+/**
+ * @brief Age of a partial batch, in LOGGING_BATCH_CLOCK() units, before it is delivered.
+ *
+ * Checked when a record is appended, by Logging_Flush() and by every
+ * deferred drain pass. 0 (default) makes the latter two deliver whatever is
+ * pending; a periodic Logging_Flush() then sends one batch per period, an
+ * interval lets several periods share one batch.
+ */
+#ifndef LOGGING_BATCH_FLUSH_INTERVAL_MS
+#define LOGGING_BATCH_FLUSH_INTERVAL_MS 0
+#endif
+
+#if LOGGING_BATCH_FLUSH_INTERVAL_MS > 0
+/**
+ * @brief Millisecond clock of the flush interval.
+ *
+ * Defaults to calling Logging_GetMilliseconds(), the same application hook
+ * as the rate limiter clock.
+ */
+#ifndef LOGGING_BATCH_CLOCK
+#define LOGGING_BATCH_CLOCK() Logging_GetMilliseconds()
+#endif
+#endif
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#if LOGGING_BATCH_FLUSH_INTERVAL_MS > 0
+/**
+ * @brief Default clock hook of the flush interval, implemented by the
+ *        application when LOGGING_BATCH_CLOCK() is not defined.
+ *
+ * @return uint32_t Free-running millisecond counter.
+ */
+uint32_t Logging_GetMilliseconds(void);
+#endif
+
+/**
+ * @brief Route the log macros through the batching stage.
+ *
+ * @param batch_func Function receiving full batches, NULL disables logging.
+ *
+ * @note Replaces the function registered by Logging_Init() and vice versa.
+ *       Pending records are delivered by Logging_Flush(), so a logging task
+ *       bounds the latency by calling it periodically (see also
+ *       LOGGING_BATCH_FLUSH_INTERVAL_MS).
+ *
+ * @example
+ * @code
+ * static int udp_batch(const Logging_Span_t *records, size_t count) {
+ *     // One datagram for the whole batch
+ *     return udp_send(log_socket, records[0].data, Logging_BatchLength(records, count));
+ * }
+ *
+ * int main(void) {
+ *     Logging_InitBatch(udp_batch);
+ *     LogInfo("System initialized successfully");
+ * }
+ *
+ * void logging_task(void *arg) {
+ *     for (;;) {
+ *         Logging_Flush();   // Drains the deferred ring too, then sends the partial batch
+ *         vTaskDelay(pdMS_TO_TICKS(50));
+ *     }
+ * }
+ * @endcode
+ */
+void Logging_InitBatch(Logging_BatchFunction_t batch_func);
+
+/**
+ * @brief Append one finished record to the batch, a Logging_WriteFunction_t.
+ *
+ * For byte outputs that bypass the formatter: Logging_AddSink(),
+ * Logging_InitTokenized(), Logging_InitKV(). Delivered to the function
+ * registered with Logging_InitBatch(), together with formatted messages.
+ *
+ * @param data   Record bytes.
+ * @param length Number of bytes, records longer than LOGGING_BATCH_BUFFER_SIZE are dropped.
+ * @return int Number of bytes appended, 0 when dropped.
+ */
+int Logging_BatchWrite(const uint8_t *data, size_t length);
+
+/**
+ * @brief Deliver the pending records now, regardless of the flush interval.
+ *
+ * For shutdown paths. Does nothing when the batch is empty or another
+ * context is appending.
+ */
+void Logging_BatchFlush(void);
+
+/**
+ * @brief Get the number of records dropped by the batching stage.
+ *
+ * A record is dropped when another context is appending or delivering at
+ * the same moment, or when a byte record does not fit in the buffer.
+ *
+ * @return uint32_t Dropped record counter since startup.
+ */
+uint32_t Logging_GetBatchDropped(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LOGGING_BATCH */
+
+#endif /* LOGGING_BATCH_H */
@@ -0,0 +1,142 @@
+/**
+ * @file: logging_compress.h
+ * @author: Paweł Kawula (pawel.kawula@kelectronics.pl)
+ * @brief: Streaming block compressor between the buffered stages and a byte output
+ * -----
+ * Copyright 2025 - KElectronics
+ * -----
+ * @note: Enabled with LOGGING_COMPRESS. Blocks of records (a batch from
+ *        the batching stage, or any byte record) are compressed with the
+ *        LZ4 block format and written to the function registered with
+ *        Logging_InitCompress(). Matches may reach back into earlier blocks
+ *        up to LOGGING_COMPRESS_WINDOW bytes, so small blocks of repetitive
+ *        log lines still compress well. Static memory only, no heap.
+ *        tools/logging_unpack.py restores the original byte stream.
+ *
+ * Block layout (multi-byte values little endian):
+ * @code
+ * u16 length           original bytes; LOGGING_COMPRESS_RESTART set when the block uses no history
+ * u16 stored           bytes following; equal to the original length: stored as is
+ * stored bytes         LZ4 block sequences, or the original bytes
+ * @endcode
+ */
+
+#ifndef LOGGING_COMPRESS_H
+#define LOGGING_COMPRESS_H
+
+#include <stdint.h>
+
+/* Wire format - shared with the host tool, independent of LOGGING_COMPRESS */
+#define LOGGING_COMPRESS_RESTART 0x8000u
+#define LOGGING_COMPRESS_HEADER_SIZE 4u
+
+#ifdef LOGGING_COMPRESS
+
+#include <stddef.h>
+
+#include "logging_batch.h"
+#include "logging_types.h"
+
+/**
+ * @brief Largest number of original bytes per block, longer writes are split.
+ *
+ * Defaults to the batch buffer, so one batch becomes one block.
+ */
+#ifndef LOGGING_COMPRESS_BLOCK_SIZE
+#ifdef LOGGING_BATCH
+#define LOGGING_COMPRESS_BLOCK_SIZE LOGGING_BATCH_BUFFER_SIZE
+#else
+#define LOGGING_COMPRESS_BLOCK_SIZE 512
+#endif
+#endif
+
+/**
+ * @brief History kept from earlier blocks, in bytes.
+ *
+ * RAM use is LOGGING_COMPRESS_WINDOW + 2 * LOGGING_COMPRESS_BLOCK_SIZE plus
+ * the hash table. Larger windows find more repeats in slow streams.
+ */
+#ifndef LOGGING_COMPRESS_WINDOW
+#define LOGGING_COMPRESS_WINDOW 2048
+#endif
+
+/**
+ * @brief Hash table size as a power of two, 2 bytes per entry.
+ */
+#ifndef LOGGING_COMPRESS_HASH_BITS
+#define LOGGING_COMPRESS_HASH_BITS 10
+#endif
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * @brief Byte counters of the compressor.
+ */
+typedef struct
+{
+    uint32_t original; /**< Bytes handed to the compressor */
+    uint32_t written;  /**< Bytes written to the output, block headers included */
+    uint32_t dropped;  /**< Records lost because another context was compressing */
+} Logging_CompressStats_t;
+
+/**
+ * @brief Register the output receiving the compressed blocks.
+ *
+ * One call of write_func per block. Does not change the log macro sink:
+ * route records here with Logging_InitBatch(Logging_CompressBatch), or
+ * register Logging_CompressWrite() as a byte output.
+ *
+ * @param write_func Function receiving complete blocks, NULL discards them.
+ *
+ * @example
+ * @code
+ * Logging_InitCompress(modem_write);          // or a flash log writer
+ * Logging_InitBatch(Logging_CompressBatch);   // ring -> batch -> compressor -> modem
+ * LogInfo("Uplink started");
+ * @endcode
+ */
+void Logging_InitCompress(Logging_WriteFunction_t write_func);
+
+/**
+ * @brief Compress bytes as one or more blocks, a Logging_WriteFunction_t.
+ *
+ * @param data   Original bytes (text lines, tokenized frames, key/value records).
+ * @param length Number of bytes.
+ * @return int Number of bytes written to the output, 0 when dropped.
+ */
+int Logging_CompressWrite(const uint8_t *data, size_t length);
+
+/**
+ * @brief Compress a batch as one block, a Logging_BatchFunction_t.
+ *
+ * @param records Records in logging order, back to back.
+ * @param count   Number of records.
+ * @return int Number of bytes written to the output.
+ */
+int Logging_CompressBatch(const Logging_Span_t *records, size_t count);
+
+/**
+ * @brief Forget the history, the next block can be decoded on its own.
+ *
+ * E.g. when a new flash sector starts, so a reader can begin there after
+ * older sectors were erased. Costs compression ratio, not correctness.
+ */
+void Logging_CompressReset(void);
+
+/**
+ * @brief Get the byte counters of the compressor.
+ *
+ * @param stats Filled with the counters since startup.
+ */
+void Logging_GetCompressStats(Logging_CompressStats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LOGGING_COMPRESS */
+
+#endif /* LOGGING_COMPRESS_H */
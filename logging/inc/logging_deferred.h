@@ -0,0 +1,298 @@
+/**
+ * @file: logging_deferred.h
+ * @author: Paweł Kawula (pawel.kawula@kelectronics.pl)
+ * @brief: Deferred (binary) logging mode - capture at the call site, format later
+ * -----
+ * Copyright 2025 - KElectronics
+ * -----
+ * @note: Enabled with LOGGING_DEFERRED. The call site only stores the
+ *        compile-time concatenated format pointer and the raw argument
+ *        words into a lock-free ring buffer; the registered
+ *        Logging_Function_t runs later from Logging_Flush() or
+ *        Logging_DeferredProcess().
+ *
+ *        The default ring is single-producer (one logging context). Define
+ *        LOGGING_DEFERRED_MPSC when several tasks, ISRs or cores log
+ *        concurrently - producers then reserve slots with an atomic CAS and
+ *        never take a lock. LOGGING_DEFERRED_PER_CORE gives every core (or
+ *        thread) its own single-producer ring instead, so producers share
+ *        nothing; the drain merges the rings by call site timestamp. In all
+ *        variants a single context drains.
+ */
+
+#ifndef LOGGING_DEFERRED_H
+#define LOGGING_DEFERRED_H
+
+#ifdef LOGGING_DEFERRED
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Maximum number of argument words captured per log call.
+ *
+ * Includes the function name argument added by LOGGING_PRINT_FUNCTION_NAME.
+ * Fixed by the capture macros below.
+ */
+#define LOGGING_DEFERRED_MAX_ARGS 8
+
+/**
+ * @brief Number of records held by the deferred ring buffer (power of two).
+ */
+#ifndef LOGGING_DEFERRED_QUEUE_LEN
+#define LOGGING_DEFERRED_QUEUE_LEN 64
+#endif
+
+/**
+ * @brief Overflow policies, selected with LOGGING_DEFERRED_OVERFLOW.
+ *
+ * - LOGGING_OVERFLOW_DROP: the new record is dropped. Producers never wait.
+ * - LOGGING_OVERFLOW_OVERWRITE: the oldest pending record is replaced by the
+ *   new one, the output keeps the most recent history. Single-producer
+ *   shared ring only (no LOGGING_DEFERRED_MPSC / LOGGING_DEFERRED_PER_CORE).
+ * - LOGGING_OVERFLOW_BLOCK: the producer waits for the drain up to
+ *   LOGGING_DEFERRED_BLOCK_TIMEOUT_MS, then drops. Never from an ISR, and
+ *   the drain must run in another context.
+ *
+ * With DROP and BLOCK the last LOGGING_DEFERRED_RESERVED slots are kept for
+ * LOG_ERROR records: a flood of DEBUG/INFO/WARN messages cannot push errors out.
+ */
+#define LOGGING_OVERFLOW_DROP 0
+#define LOGGING_OVERFLOW_OVERWRITE 1
+#define LOGGING_OVERFLOW_BLOCK 2
+
+#ifndef LOGGING_DEFERRED_OVERFLOW
+#define LOGGING_DEFERRED_OVERFLOW LOGGING_OVERFLOW_DROP
+#endif
+
+/**
+ * @brief Ring slots only LOG_ERROR records may take (DROP and BLOCK policies).
+ *
+ * With LOGGING_DEFERRED_PER_CORE the reserve applies to every ring.
+ */
+#ifndef LOGGING_DEFERRED_RESERVED
+#define LOGGING_DEFERRED_RESERVED (LOGGING_DEFERRED_QUEUE_LEN / 8)
+#endif
+
+#if LOGGING_DEFERRED_OVERFLOW == LOGGING_OVERFLOW_OVERWRITE
+#if defined(LOGGING_DEFERRED_MPSC) || defined(LOGGING_DEFERRED_PER_CORE)
+#error "LOGGING_OVERFLOW_OVERWRITE needs the single-producer shared ring."
+#endif
+#elif LOGGING_DEFERRED_OVERFLOW == LOGGING_OVERFLOW_BLOCK
+
+/**
+ * @brief Longest wait for a free slot, in LOGGING_DEFERRED_CLOCK() units.
+ */
+#ifndef LOGGING_DEFERRED_BLOCK_TIMEOUT_MS
+#define LOGGING_DEFERRED_BLOCK_TIMEOUT_MS 10
+#endif
+
+/**
+ * @brief Millisecond clock of the blocking policy.
+ *
+ * Defaults to calling Logging_GetMilliseconds(), the same application hook
+ * as the rate limiter clock.
+ */
+#ifndef LOGGING_DEFERRED_CLOCK
+#define LOGGING_DEFERRED_CLOCK() Logging_GetMilliseconds()
+#endif
+
+/**
+ * @brief Called between two attempts while the ring is full.
+ *
+ * Busy waits by default; define it to yield (e.g. taskYIELD(), sched_yield())
+ * so the drain task gets to run.
+ */
+#ifndef LOGGING_DEFERRED_WAIT
+#define LOGGING_DEFERRED_WAIT() ((void)0)
+#endif
+
+#elif LOGGING_DEFERRED_OVERFLOW != LOGGING_OVERFLOW_DROP
+#error "LOGGING_DEFERRED_OVERFLOW must be LOGGING_OVERFLOW_DROP, _OVERWRITE or _BLOCK."
+#endif
+
+/**
+ * @brief In-band notice written by the drain once the ring is empty again
+ *        after messages were dropped; takes the number of lost messages
+ *        (unsigned long). Define as NULL to disable.
+ */
+#ifndef LOGGING_DEFERRED_DROPPED_MESSAGE
+#define LOGGING_DEFERRED_DROPPED_MESSAGE "[WARN]  Log buffer overflow, %lu messages dropped\r\n"
+#endif
+
+#ifdef LOGGING_DEFERRED_PER_CORE
+
+#ifdef LOGGING_DEFERRED_MPSC
+#error "LOGGING_DEFERRED_PER_CORE and LOGGING_DEFERRED_MPSC are mutually exclusive."
+#endif
+
+#ifndef LOGGING_TIMESTAMP
+#error "LOGGING_DEFERRED_PER_CORE merges by call site timestamp, define LOGGING_TIMESTAMP."
+#endif
+
+/**
+ * @brief Number of per-core rings, each LOGGING_DEFERRED_QUEUE_LEN records long.
+ */
+#ifndef LOGGING_DEFERRED_CORES
+#define LOGGING_DEFERRED_CORES 2
+#endif
+
+/**
+ * @brief Ring selector of the calling context, 0 .. LOGGING_DEFERRED_CORES - 1.
+ *
+ * Defaults to calling Logging_GetCoreId(), provided by the application
+ * (e.g. the CPUID / SIO register on multi-core MCUs, a thread-local index
+ * on Linux). Every ring must have a single producer: contexts that can
+ * preempt each other on one core (task and ISR) need separate indices.
+ */
+#ifndef LOGGING_DEFERRED_CORE_ID
+#define LOGGING_DEFERRED_CORE_ID() Logging_GetCoreId()
+#endif
+
+#endif /* LOGGING_DEFERRED_PER_CORE */
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#if LOGGING_DEFERRED_OVERFLOW == LOGGING_OVERFLOW_BLOCK
+/**
+ * @brief Default clock hook of the blocking policy, implemented by the
+ *        application when LOGGING_DEFERRED_CLOCK() is not defined.
+ *
+ * @return uint32_t Free-running millisecond counter.
+ */
+uint32_t Logging_GetMilliseconds(void);
+#endif
+
+#ifdef LOGGING_DEFERRED_PER_CORE
+/**
+ * @brief Default ring selector hook, implemented by the application when
+ *        LOGGING_DEFERRED_CORE_ID() is not defined.
+ *
+ * @return unsigned Index of the calling core or thread.
+ */
+unsigned Logging_GetCoreId(void);
+#endif
+
+/**
+ * @brief One captured log call.
+ *
+ * @note Arguments are stored as raw machine words: integers up to the size
+ *       of a pointer, and pointers. String arguments are stored by address,
+ *       so they must stay valid until the record is processed (string
+ *       literals and __func__ always are). Floating-point arguments, and
+ *       64-bit integers where a pointer is 32 bits, are not supported in
+ *       deferred mode and are rejected at compile time.
+ */
+typedef struct
+{
+    const char *format;
+    uint8_t arg_count;
+    uintptr_t args[LOGGING_DEFERRED_MAX_ARGS];
+} Logging_DeferredRecord_t;
+
+/**
+ * @brief Reserve the next free record in the deferred ring buffer.
+ *
+ * Used by the capture macros, not intended to be called directly.
+ *
+ * @param level Level of the message (LOG_ERROR may take the reserved slots).
+ * @return Logging_DeferredRecord_t* Record to fill, or NULL when there is no room
+ *         under LOGGING_DEFERRED_OVERFLOW (the message is counted as dropped).
+ */
+Logging_DeferredRecord_t *Logging_DeferredAcquire(uint8_t level);
+
+/**
+ * @brief Publish a record previously returned by Logging_DeferredAcquire().
+ *
+ * @param record Record filled by the call site.
+ */
+void Logging_DeferredCommit(Logging_DeferredRecord_t *record);
+
+/**
+ * @brief Format pending records through the registered logging function.
+ *
+ * Intended to run from a low-priority task or idle hook. Each record is
+ * replayed as a single call to the function passed to Logging_Init(), with
+ * the original format string. With LOGGING_DEFERRED_PER_CORE the rings are
+ * merged: the oldest pending record by timestamp goes first.
+ *
+ * @param max_records Maximum number of records to process, 0 processes all pending records.
+ * @return size_t Number of records processed.
+ */
+size_t Logging_DeferredProcess(size_t max_records);
+
+/**
+ * @brief Get the number of records waiting in the deferred ring buffer.
+ *
+ * @return size_t Number of pending records.
+ */
+size_t Logging_DeferredPending(void);
+
+/**
+ * @brief Get the number of messages dropped because the ring buffer was full.
+ *
+ * Overwritten records (LOGGING_OVERFLOW_OVERWRITE) count as dropped.
+ *
+ * @return uint32_t Dropped message counter since startup.
+ */
+uint32_t Logging_DeferredDropped(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+/* Raw argument word stores - one store per argument */
+#define LOGGING_STORE_ARGS_0(d) (void)(d)
+#define LOGGING_STORE_ARGS_1(d, a1) \
+    (d)[0] = (uintptr_t)(a1)
+#define LOGGING_STORE_ARGS_2(d, a1, a2) \
+    LOGGING_STORE_ARGS_1(d, a1); (d)[1] = (uintptr_t)(a2)
+#define LOGGING_STORE_ARGS_3(d, a1, a2, a3) \
+    LOGGING_STORE_ARGS_2(d, a1, a2); (d)[2] = (uintptr_t)(a3)
+#define LOGGING_STORE_ARGS_4(d, a1, a2, a3, a4) \
+    LOGGING_STORE_ARGS_3(d, a1, a2, a3); (d)[3] = (uintptr_t)(a4)
+#define LOGGING_STORE_ARGS_5(d, a1, a2, a3, a4, a5) \
+    LOGGING_STORE_ARGS_4(d, a1, a2, a3, a4); (d)[4] = (uintptr_t)(a5)
+#define LOGGING_STORE_ARGS_6(d, a1, a2, a3, a4, a5, a6) \
+    LOGGING_STORE_ARGS_5(d, a1, a2, a3, a4, a5); (d)[5] = (uintptr_t)(a6)
+#define LOGGING_STORE_ARGS_7(d, a1, a2, a3, a4, a5, a6, a7) \
+    LOGGING_STORE_ARGS_6(d, a1, a2, a3, a4, a5, a6); (d)[6] = (uintptr_t)(a7)
+#define LOGGING_STORE_ARGS_8(d, a1, a2, a3, a4, a5, a6, a7, a8) \
+    LOGGING_STORE_ARGS_7(d, a1, a2, a3, a4, a5, a6, a7); (d)[7] = (uintptr_t)(a8)
+
+#define LOGGING_STORE_ARGS(d, ...) \
+    LOGGING_CONCAT(LOGGING_STORE_ARGS_, LOGGING_NARGS(__VA_ARGS__))(d, ##__VA_ARGS__)
+
+/* Call site capture: format pointer + argument words, no formatting */
+#define LOGGING_DEFER(message, ...)                                                  \
+    do                                                                               \
+    {                                                                                \
+        LOGGING_CHECK_FORMAT(message, ##__VA_ARGS__);                                \
+        LOGGING_STATIC_ASSERT(!LOGGING_ARG_TYPES_CONTAIN(LOGGING_ARG_TYPES(__VA_ARGS__), \
+                                                         LOGGING_ARG_DOUBLE),        \
+                              logging_deferred_no_floating_point_args_);             \
+        LOGGING_STATIC_ASSERT((sizeof(uintptr_t) >= 8u) ||                           \
+                                  !LOGGING_ARG_TYPES_CONTAIN(LOGGING_ARG_TYPES(__VA_ARGS__), \
+                                                             LOGGING_ARG_INT64),     \
+                              logging_deferred_no_args_wider_than_a_word_);          \
+        Logging_DeferredRecord_t *logging_record_ =                                  \
+            Logging_DeferredAcquire((uint8_t)LOGGING_TAG_LEVEL(message));            \
+        if (logging_record_ != NULL)                                                 \
+        {                                                                            \
+            logging_record_->format = (message);                                     \
+            logging_record_->arg_count = (uint8_t)LOGGING_NARGS(__VA_ARGS__);        \
+            LOGGING_STORE_ARGS(logging_record_->args, ##__VA_ARGS__);                \
+            Logging_DeferredCommit(logging_record_);                                 \
+        }                                                                            \
+        else                                                                         \
+        {                                                                            \
+            LOGGING_STATS_DROPPED_TAG(message);                                      \
+        }                                                                            \
+    } while (0)
+
+#endif /* LOGGING_DEFERRED */
+
+#endif /* LOGGING_DEFERRED_H */
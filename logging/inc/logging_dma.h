@@ -0,0 +1,107 @@
+/**
+ * @file: logging_dma.h
+ * @author: Paweł Kawula (pawel.kawula@kelectronics.pl)
+ * @brief: Double-buffered (ping-pong) output stage for DMA driven UART/USB transmit
+ * -----
+ * Copyright 2025 - KElectronics
+ * -----
+ * @note: Enabled with LOGGING_DMA. Messages are formatted straight into the
+ *        half that is being filled while the other half is transmitted by
+ *        the application's DMA. The transfer complete interrupt calls
+ *        Logging_DmaComplete(), which hands over the filled half. The CPU
+ *        never waits for the peripheral.
+ */
+
+#ifndef LOGGING_DMA_H
+#define LOGGING_DMA_H
+
+#ifdef LOGGING_DMA
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Size of each of the two halves in bytes.
+ *
+ * One half collects messages while the other is transmitted, so this
+ * bounds the output produced during one transfer. A single message longer
+ * than a half is truncated, keeping the trailing "\r\n".
+ */
+#ifndef LOGGING_DMA_BUFFER_SIZE
+#define LOGGING_DMA_BUFFER_SIZE 256
+#endif
+
+/*
+ * Optionally place the buffers in DMA accessible memory, e.g.
+ * LOGGING_DMA_BUFFER_SECTION=".dma_buffer" (set by the application).
+ */
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * @brief DMA start callback, begins a transfer of one filled half.
+ *
+ * The data stays untouched until Logging_DmaComplete() is called. Runs from
+ * the logging context or from Logging_DmaComplete() (interrupt context).
+ * On cached cores clean the data cache for the range before starting.
+ *
+ * @param data   First byte of the half.
+ * @param length Number of bytes to transmit.
+ */
+typedef void (*Logging_DmaStartFunction_t)(const uint8_t *data, size_t length);
+
+/**
+ * @brief Route the log macros through the ping-pong output stage.
+ *
+ * @param start_func DMA start callback, NULL disables logging.
+ *
+ * @note Replaces the function registered by Logging_Init() and vice versa.
+ *
+ * @example
+ * @code
+ * static void uart_dma_start(const uint8_t *data, size_t length) {
+ *     HAL_UART_Transmit_DMA(&huart2, (uint8_t *)data, length);
+ * }
+ *
+ * void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart) {
+ *     Logging_DmaComplete();
+ * }
+ *
+ * int main(void) {
+ *     Logging_InitDma(uart_dma_start);
+ *     LogInfo("System initialized successfully");
+ * }
+ * @endcode
+ */
+void Logging_InitDma(Logging_DmaStartFunction_t start_func);
+
+/**
+ * @brief Transfer complete hook, call from the DMA/peripheral completion interrupt.
+ *
+ * Releases the transmitted half and starts the next transfer when the other
+ * half holds data. May also be called from inside the start callback when
+ * the transfer finishes synchronously.
+ */
+void Logging_DmaComplete(void);
+
+/**
+ * @brief Get the number of messages dropped by the output stage.
+ *
+ * A message is dropped when the filling half has no room left for it (the
+ * transfer of the other half is still in progress) or when another context
+ * is appending at the same moment.
+ *
+ * @return uint32_t Dropped message counter since startup.
+ */
+uint32_t Logging_GetDmaDropped(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LOGGING_DMA */
+
+#endif /* LOGGING_DMA_H */
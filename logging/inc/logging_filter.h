@@ -0,0 +1,111 @@
+/**
+ * @file: logging_filter.h
+ * @author: Paweł Kawula (pawel.kawula@kelectronics.pl)
+ * @brief: Runtime per-module level filter layered under LOGGING_TOP_LOG_LEVEL
+ * -----
+ * Copyright 2025 - KElectronics
+ * -----
+ * @note: Enabled with LOGGING_RUNTIME_FILTER. Levels above the compile-time
+ *        ceiling are still removed by the preprocessor; levels below it are
+ *        checked at runtime with a single byte load and compare.
+ */
+
+#ifndef LOGGING_FILTER_H
+#define LOGGING_FILTER_H
+
+#ifdef LOGGING_RUNTIME_FILTER
+
+#include <stdint.h>
+
+/**
+ * @brief Runtime level every module starts with.
+ *
+ * Defaults to the compile-time ceiling, so enabling the filter does not
+ * change the output until Logging_SetModuleLevel() is called.
+ */
+#ifndef LOGGING_RUNTIME_DEFAULT_LEVEL
+#define LOGGING_RUNTIME_DEFAULT_LEVEL LOGGING_TOP_LOG_LEVEL
+#endif
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * @brief Runtime level slot of one translation unit of a named module.
+ *
+ * One node is defined (static) by every translation unit compiled with
+ * LOGGING_LOG_NAME and registered before main() by a constructor.
+ */
+typedef struct Logging_Module
+{
+    const char *name;
+    volatile uint8_t *level;
+    struct Logging_Module *next;
+} Logging_Module_t;
+
+/**
+ * @brief Runtime level of code compiled without LOGGING_LOG_NAME.
+ */
+extern volatile uint8_t logging_unnamed_level;
+
+/**
+ * @brief Register a module level slot, called by the per-file constructor.
+ *
+ * @param module Statically allocated module node.
+ */
+void Logging_RegisterModule(Logging_Module_t *module);
+
+/**
+ * @brief Change the runtime log level of a module.
+ *
+ * Messages of a module are printed when their level is at or below both
+ * LOGGING_TOP_LOG_LEVEL (compile time) and the module runtime level.
+ *
+ * @param name  Module name as given by LOGGING_LOG_NAME. Pass "" for code
+ *              compiled without a name, or NULL to change every module.
+ * @param level New runtime level (LOG_NONE ... LOG_DEBUG).
+ * @return int Number of updated level slots, -1 when the level is invalid.
+ *
+ * @example
+ * @code
+ * Logging_SetModuleLevel("NET", LOG_DEBUG);   // Raise verbosity of one module
+ * Logging_SetModuleLevel(NULL, LOG_WARN);     // Quiet everything else down
+ * @endcode
+ */
+int Logging_SetModuleLevel(const char *name, int level);
+
+/**
+ * @brief Get the runtime log level of a module.
+ *
+ * @param name Module name as given by LOGGING_LOG_NAME, "" for unnamed code.
+ * @return int Current runtime level, -1 when no such module is registered.
+ */
+int Logging_GetModuleLevel(const char *name);
+
+#ifdef __cplusplus
+}
+#endif
+
+#ifdef LOGGING_LOG_NAME
+/* Per translation unit level slot, registered under LOGGING_LOG_NAME */
+static volatile uint8_t logging_module_level_ = LOGGING_RUNTIME_DEFAULT_LEVEL;
+static Logging_Module_t logging_module_ = { LOGGING_LOG_NAME, &logging_module_level_, 0 };
+
+__attribute__((constructor)) static void logging_module_register_(void)
+{
+    Logging_RegisterModule(&logging_module_);
+}
+
+#define LOGGING_MODULE_LEVEL logging_module_level_
+#else
+#define LOGGING_MODULE_LEVEL logging_unnamed_level
+#endif
+
+/* Single byte load and compare, passing the filter is the unlikely case */
+#define LOGGING_RUNTIME_ENABLED(level) LOGGING_UNLIKELY((level) <= LOGGING_MODULE_LEVEL)
+
+#endif /* LOGGING_RUNTIME_FILTER */
+
+#endif /* LOGGING_FILTER_H */
@@ -0,0 +1,158 @@
+/**
+ * @file: logging_format.h
+ * @author: Paweł Kawula (pawel.kawula@kelectronics.pl)
+ * @brief: Compile-time format string checking and argument type descriptors
+ * -----
+ * Copyright 2025 - KElectronics
+ * -----
+ * @note: Logging_Function_t is a plain variadic pointer, so the compiler
+ *        cannot check arguments against the format. Every log site also
+ *        calls Logging_FormatCheck() - an inline printf-attributed function -
+ *        in an unevaluated branch, which gives full -Wformat diagnostics in
+ *        all output modes and costs no code.
+ *
+ *        LOGGING_ARG_TYPES() encodes the argument types of a site into one
+ *        32-bit constant, so binary encoders serialize arguments without
+ *        parsing the format at runtime.
+ *
+ *        Logging_FormatV() is the library's own formatter: reentrant, no
+ *        heap, no libc printf, limited to the conversions log messages use.
+ */
+
+#ifndef LOGGING_FORMAT_H
+#define LOGGING_FORMAT_H
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(__GNUC__) || defined(__clang__)
+#define LOGGING_PRINTF_FORMAT(format_index, args_index) \
+    __attribute__((format(printf, format_index, args_index)))
+#else
+#define LOGGING_PRINTF_FORMAT(format_index, args_index)
+#endif
+
+/**
+ * @brief Format checking target, never called at runtime.
+ *
+ * @return int Always 0.
+ */
+static inline int Logging_FormatCheck(const char *format, ...) LOGGING_PRINTF_FORMAT(1, 2);
+
+static inline int Logging_FormatCheck(const char *format, ...)
+{
+    (void)format;
+    return 0;
+}
+
+/* Arguments are type checked but never evaluated (define LOGGING_NO_FORMAT_CHECK to skip) */
+#ifndef LOGGING_NO_FORMAT_CHECK
+#define LOGGING_CHECK_FORMAT(message, ...) ((void)(0 && Logging_FormatCheck(message, ##__VA_ARGS__)))
+#else
+#define LOGGING_CHECK_FORMAT(message, ...) ((void)0)
+#endif
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * @brief Format a message into a caller provided buffer, vsnprintf() replacement.
+ *
+ * Supports %d %i %u %x %X %p %f %F %s %c %% with the flags "-0+ #", width
+ * and precision (both also as *) and the length modifiers hh h l ll j z t L.
+ * %f is limited to 9 fraction digits and values below 2^64 ("inf"
+ * otherwise, "INF" / "NAN" for %F). %e %g %a %o are copied to the output unchanged, their
+ * argument is still consumed so the following conversions stay aligned;
+ * %n is copied too and never stores anything.
+ * Reentrant: uses only the caller buffer and a few bytes of stack.
+ *
+ * @param buffer Destination, always NUL terminated when size > 0.
+ * @param size   Size of buffer in bytes.
+ * @param format printf-style format string.
+ * @param args   Arguments for format.
+ * @return int Length of the complete output without the NUL, like vsnprintf() -
+ *             a value >= size means the output was truncated.
+ *
+ * @example
+ * @code
+ * static int uart_vlogger(const char *message, va_list args) {
+ *     char line[96];
+ *     int length = Logging_FormatV(line, sizeof(line), message, args);
+ *     return uart_send(line, (length < (int)sizeof(line)) ? length : (int)sizeof(line) - 1);
+ * }
+ * @endcode
+ */
+int Logging_FormatV(char *buffer, size_t size, const char *format, va_list args) LOGGING_PRINTF_FORMAT(3, 0);
+
+/**
+ * @brief Variadic form of Logging_FormatV(), snprintf() replacement.
+ */
+int Logging_Format(char *buffer, size_t size, const char *format, ...) LOGGING_PRINTF_FORMAT(3, 4);
+
+#ifdef __cplusplus
+}
+#endif
+
+/* Argument type codes, 3 bits each (see LOGGING_ARG_TYPES) */
+#define LOGGING_ARG_INT32   1u
+#define LOGGING_ARG_INT64   2u
+#define LOGGING_ARG_DOUBLE  3u
+#define LOGGING_ARG_STRING  4u
+#define LOGGING_ARG_POINTER 5u
+
+#if defined(__GNUC__) || defined(__clang__)
+
+/* Compile-time argument type classification (GCC/Clang builtins, no evaluation) */
+#define LOGGING_ARG_TYPE(x)                                                     \
+    ((__builtin_types_compatible_p(__typeof__((x) + 0), char *) ||              \
+      __builtin_types_compatible_p(__typeof__((x) + 0), const char *))          \
+         ? LOGGING_ARG_STRING                                                   \
+     : (__builtin_classify_type((x) + 0) == 8) ? LOGGING_ARG_DOUBLE             \
+     : (__builtin_classify_type((x) + 0) == 5) ? LOGGING_ARG_POINTER            \
+     : (sizeof((x) + 0) > 4u)                  ? LOGGING_ARG_INT64              \
+                                               : LOGGING_ARG_INT32)
+
+/* Descriptor: argument count in bits 0..3, type of argument n in bits (4 + 3n)..(6 + 3n) */
+#define LOGGING_ARG_TYPES_0() 0u
+#define LOGGING_ARG_TYPES_1(a1) \
+    (LOGGING_ARG_TYPE(a1) << 4)
+#define LOGGING_ARG_TYPES_2(a1, a2) \
+    (LOGGING_ARG_TYPES_1(a1) | (LOGGING_ARG_TYPE(a2) << 7))
+#define LOGGING_ARG_TYPES_3(a1, a2, a3) \
+    (LOGGING_ARG_TYPES_2(a1, a2) | (LOGGING_ARG_TYPE(a3) << 10))
+#define LOGGING_ARG_TYPES_4(a1, a2, a3, a4) \
+    (LOGGING_ARG_TYPES_3(a1, a2, a3) | (LOGGING_ARG_TYPE(a4) << 13))
+#define LOGGING_ARG_TYPES_5(a1, a2, a3, a4, a5) \
+    (LOGGING_ARG_TYPES_4(a1, a2, a3, a4) | (LOGGING_ARG_TYPE(a5) << 16))
+#define LOGGING_ARG_TYPES_6(a1, a2, a3, a4, a5, a6) \
+    (LOGGING_ARG_TYPES_5(a1, a2, a3, a4, a5) | (LOGGING_ARG_TYPE(a6) << 19))
+#define LOGGING_ARG_TYPES_7(a1, a2, a3, a4, a5, a6, a7) \
+    (LOGGING_ARG_TYPES_6(a1, a2, a3, a4, a5, a6) | (LOGGING_ARG_TYPE(a7) << 22))
+#define LOGGING_ARG_TYPES_8(a1, a2, a3, a4, a5, a6, a7, a8) \
+    (LOGGING_ARG_TYPES_7(a1, a2, a3, a4, a5, a6, a7) | (LOGGING_ARG_TYPE(a8) << 25))
+
+#define LOGGING_ARG_TYPES(...)                                                        \
+    ((uint32_t)LOGGING_NARGS(__VA_ARGS__) |                                           \
+     (uint32_t)LOGGING_CONCAT(LOGGING_ARG_TYPES_, LOGGING_NARGS(__VA_ARGS__))(__VA_ARGS__))
+
+/* Descriptor accessors */
+#define LOGGING_ARG_TYPES_COUNT(types) ((unsigned)((types) & 0x0Fu))
+#define LOGGING_ARG_TYPES_AT(types, n) ((unsigned)(((types) >> (4u + (3u * (n)))) & 0x07u))
+
+/* Non-zero when any described argument has the given type code (constant for constant descriptors) */
+#define LOGGING_ARG_TYPES_CONTAIN(types, code)                                    \
+    ((LOGGING_ARG_TYPES_AT(types, 0) == (code)) || (LOGGING_ARG_TYPES_AT(types, 1) == (code)) || \
+     (LOGGING_ARG_TYPES_AT(types, 2) == (code)) || (LOGGING_ARG_TYPES_AT(types, 3) == (code)) || \
+     (LOGGING_ARG_TYPES_AT(types, 4) == (code)) || (LOGGING_ARG_TYPES_AT(types, 5) == (code)) || \
+     (LOGGING_ARG_TYPES_AT(types, 6) == (code)) || (LOGGING_ARG_TYPES_AT(types, 7) == (code)))
+
+/* C99 compile-time assertion usable as a statement */
+#define LOGGING_STATIC_ASSERT(condition, name) \
+    typedef char name[(condition) ? 1 : -1] __attribute__((unused))
+
+#endif /* __GNUC__ || __clang__ */
+
+#endif /* LOGGING_FORMAT_H */
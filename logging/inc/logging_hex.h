@@ -0,0 +1,109 @@
+/**
+ * @file: logging_hex.h
+ * @author: Paweł Kawula (pawel.kawula@kelectronics.pl)
+ * @brief: Buffer dump macros - one log record with a hex rendering instead of a call per byte
+ * -----
+ * Copyright 2025 - KElectronics
+ * -----
+ * @note: LogDebugHex(data, length) converts up to LOGGING_HEX_MAX_BYTES bytes
+ *        into a stack buffer at the call site and logs them as a single
+ *        "<length> bytes: 0102AB..." message through the normal path (runtime
+ *        filter, rate limiter and statistics apply). Longer buffers are cut
+ *        and marked with "...".
+ */
+
+#ifndef LOGGING_HEX_H
+#define LOGGING_HEX_H
+
+#include <stddef.h>
+
+#include "logging_stack.h"
+
+/**
+ * @brief Most bytes rendered by one hex dump, also sizes its stack buffer (2 * N + 1).
+ */
+#ifndef LOGGING_HEX_MAX_BYTES
+#define LOGGING_HEX_MAX_BYTES 32
+#endif
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * @brief Render bytes as uppercase hex characters, two per byte, no separators.
+ *
+ * Table driven, with SSE2 / AArch64 NEON paths converting 16 bytes at a time
+ * on hosts that have them.
+ *
+ * @param buffer Output, always NUL terminated when size > 0.
+ * @param size   Size of the output buffer.
+ * @param data   Bytes to render.
+ * @param length Number of bytes.
+ * @return size_t Number of bytes rendered, less than length when the buffer is too small.
+ *
+ * @example
+ * @code
+ * char hex[2 * 6 + 1];
+ * Logging_HexEncode(hex, sizeof(hex), mac, 6);   // "0080E1A2B3C4"
+ * @endcode
+ */
+size_t Logging_HexEncode(char *buffer, size_t size, const void *data, size_t length);
+
+#ifdef __cplusplus
+}
+#endif
+
+#if defined(LOGGING_DEFERRED)
+/* Deferred records keep argument words only, the stack buffer would be gone when the ring is processed */
+#define LOG_HEX_AT_LEVEL(level, tag, data, length) \
+    LOGGING_STATIC_ASSERT(0, logging_hex_dump_is_not_available_in_deferred_mode_)
+#else
+#define LOG_HEX_AT_LEVEL(level, tag, data, length)                                                   \
+    do                                                                                               \
+    {                                                                                                \
+        LOGGING_SITE(level);                                                                         \
+        if (LOGGING_SITE_ENABLED() && LOG_ENABLED(level))                                            \
+        {                                                                                            \
+            char logging_hex_[(2 * (LOGGING_HEX_MAX_BYTES)) + 1];                                    \
+            size_t logging_hex_length_ = (size_t)(length);                                           \
+            size_t logging_hex_shown_ =                                                              \
+                Logging_HexEncode(logging_hex_, sizeof(logging_hex_), (data), logging_hex_length_);  \
+            LOGGING_STATS_EMITTED(level);                                                            \
+            LOG_EMIT(level, tag, "%u bytes: %s%s", (unsigned)logging_hex_length_, logging_hex_,      \
+                     (logging_hex_shown_ < logging_hex_length_) ? "..." : "");                       \
+        }                                                                                            \
+    } while (0)
+#endif
+
+/* Same compile-time ceiling as the text macros */
+#if defined(LOGGING_DISABLED_GLOBALLY)
+#define LogErrorHex(data, length)
+#define LogWarnHex(data, length)
+#define LogInfoHex(data, length)
+#define LogDebugHex(data, length)
+#else
+#if LOGGING_TOP_LOG_LEVEL >= LOG_ERROR
+#define LogErrorHex(data, length) LOG_HEX_AT_LEVEL(LOG_ERROR, "[ERROR] ", data, length)
+#else
+#define LogErrorHex(data, length)
+#endif
+#if LOGGING_TOP_LOG_LEVEL >= LOG_WARN
+#define LogWarnHex(data, length) LOG_HEX_AT_LEVEL(LOG_WARN, "[WARN]  ", data, length)
+#else
+#define LogWarnHex(data, length)
+#endif
+#if LOGGING_TOP_LOG_LEVEL >= LOG_INFO
+#define LogInfoHex(data, length) LOG_HEX_AT_LEVEL(LOG_INFO, "[INFO]  ", data, length)
+#else
+#define LogInfoHex(data, length)
+#endif
+#if LOGGING_TOP_LOG_LEVEL >= LOG_DEBUG
+#define LogDebugHex(data, length) LOG_HEX_AT_LEVEL(LOG_DEBUG, "[DEBUG] ", data, length)
+#else
+#define LogDebugHex(data, length)
+#endif
+#endif
+
+#endif /* LOGGING_HEX_H */
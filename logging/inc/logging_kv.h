@@ -0,0 +1,261 @@
+/**
+ * @file: logging_kv.h
+ * @author: Paweł Kawula (pawel.kawula@kelectronics.pl)
+ * @brief: Structured key/value logging with a compact binary record format
+ * -----
+ * Copyright 2025 - KElectronics
+ * -----
+ * @note: Enabled with LOGGING_KV. LogInfoKV("event", KV_U32("len", n), ...)
+ *        encodes one length-prefixed binary record per call and hands it to
+ *        the function registered with Logging_InitKV(). No text is built, so
+ *        the receiving side reads typed fields instead of parsing the
+ *        "[LEVEL] [NAME] (func):line - msg" line. Records are decoded by
+ *        tools/kv (C decoder library and the logging_kv_json converter).
+ *
+ * Record layout (multi-byte values little endian):
+ * @code
+ * u16 length           bytes following this field
+ * u8  level            LOG_ERROR..LOG_DEBUG, bit 7 set when fields were cut
+ * u16 module           LOGGING_MODULE_ID of the emitting translation unit
+ * u16 line             __LINE__ of the call site
+ * u8  event length, event characters
+ * fields until the end of the record:
+ *     u8 type, u8 key length, key characters, value
+ *     U32/I32/F32: 4 bytes, U64/I64: 8 bytes, BOOL: 1 byte,
+ *     STR: u8 length followed by the characters
+ * @endcode
+ */
+
+#ifndef LOGGING_KV_H
+#define LOGGING_KV_H
+
+#include <stdint.h>
+
+/* Wire format - shared with the host decoder, independent of LOGGING_KV */
+#define LOGGING_KV_TYPE_NONE 0u
+#define LOGGING_KV_TYPE_U32 1u
+#define LOGGING_KV_TYPE_I32 2u
+#define LOGGING_KV_TYPE_U64 3u
+#define LOGGING_KV_TYPE_I64 4u
+#define LOGGING_KV_TYPE_F32 5u
+#define LOGGING_KV_TYPE_STR 6u
+#define LOGGING_KV_TYPE_BOOL 7u
+
+/* Bytes in front of the event name: length, level, module, line */
+#define LOGGING_KV_HEADER_SIZE 7u
+
+/* Level byte flag: at least one field or string did not fit the record */
+#define LOGGING_KV_FLAG_TRUNCATED 0x80u
+#define LOGGING_KV_LEVEL_MASK 0x07u
+
+#ifdef LOGGING_KV
+
+#include <stddef.h>
+
+#include "logging_stack.h"
+
+/**
+ * @brief Stack buffer one record is encoded into.
+ *
+ * Fields that do not fit are left out (strings are cut first) and the record
+ * is flagged with LOGGING_KV_FLAG_TRUNCATED.
+ */
+#ifndef LOGGING_KV_BUFFER_SIZE
+#define LOGGING_KV_BUFFER_SIZE 96
+#endif
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * @brief One typed field of a record, built by the KV_*() macros.
+ */
+typedef struct
+{
+    const char *key;
+    union
+    {
+        uint32_t u32;
+        int32_t i32;
+        uint64_t u64;
+        int64_t i64;
+        float f32;
+        const char *str;
+    } value;
+    uint8_t type;
+} Logging_KVField_t;
+
+/**
+ * @brief Initialize structured logging with a byte output function.
+ *
+ * Independent of the text output set by Logging_Init() and friends, so
+ * records can go to a separate channel (e.g. a second UART or a socket).
+ *
+ * @param write_func Function receiving complete records, NULL disables output.
+ *
+ * @example
+ * @code
+ * static int ingest_write(const uint8_t *data, size_t length) {
+ *     return uart_send(&uart_telemetry, data, length);
+ * }
+ *
+ * int main(void) {
+ *     Logging_InitKV(ingest_write);
+ *     LogInfoKV("rx", KV_U32("len", length), KV_STR("port", "uart1"));
+ * }
+ * @endcode
+ */
+void Logging_InitKV(Logging_WriteFunction_t write_func);
+
+/**
+ * @brief Encode and emit one record, used by the KV log macros.
+ *
+ * @param level  Level of the record (LOG_ERROR ... LOG_DEBUG).
+ * @param module Module identifier.
+ * @param line   Source line of the call site.
+ * @param event  Event name, NUL terminated (cut at 255 characters).
+ * @param fields Typed fields.
+ * @param count  Number of fields.
+ */
+void Logging_KVLog(uint8_t level, uint16_t module, uint16_t line, const char *event,
+                   const Logging_KVField_t *fields, size_t count);
+
+static inline Logging_KVField_t Logging_KVFieldU32(const char *key, uint32_t value)
+{
+    Logging_KVField_t field;
+    field.key = key;
+    field.value.u32 = value;
+    field.type = LOGGING_KV_TYPE_U32;
+    return field;
+}
+
+static inline Logging_KVField_t Logging_KVFieldI32(const char *key, int32_t value)
+{
+    Logging_KVField_t field;
+    field.key = key;
+    field.value.i32 = value;
+    field.type = LOGGING_KV_TYPE_I32;
+    return field;
+}
+
+static inline Logging_KVField_t Logging_KVFieldU64(const char *key, uint64_t value)
+{
+    Logging_KVField_t field;
+    field.key = key;
+    field.value.u64 = value;
+    field.type = LOGGING_KV_TYPE_U64;
+    return field;
+}
+
+static inline Logging_KVField_t Logging_KVFieldI64(const char *key, int64_t value)
+{
+    Logging_KVField_t field;
+    field.key = key;
+    field.value.i64 = value;
+    field.type = LOGGING_KV_TYPE_I64;
+    return field;
+}
+
+static inline Logging_KVField_t Logging_KVFieldF32(const char *key, float value)
+{
+    Logging_KVField_t field;
+    field.key = key;
+    field.value.f32 = value;
+    field.type = LOGGING_KV_TYPE_F32;
+    return field;
+}
+
+static inline Logging_KVField_t Logging_KVFieldStr(const char *key, const char *value)
+{
+    Logging_KVField_t field;
+    field.key = key;
+    field.value.str = value;
+    field.type = LOGGING_KV_TYPE_STR;
+    return field;
+}
+
+static inline Logging_KVField_t Logging_KVFieldBool(const char *key, int value)
+{
+    Logging_KVField_t field;
+    field.key = key;
+    field.value.u32 = (value != 0) ? 1u : 0u;
+    field.type = LOGGING_KV_TYPE_BOOL;
+    return field;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* Field constructors - keys should be short literals, they travel in every record */
+#define KV_U32(key, value) Logging_KVFieldU32((key), (uint32_t)(value))
+#define KV_I32(key, value) Logging_KVFieldI32((key), (int32_t)(value))
+#define KV_U64(key, value) Logging_KVFieldU64((key), (uint64_t)(value))
+#define KV_I64(key, value) Logging_KVFieldI64((key), (int64_t)(value))
+#define KV_F32(key, value) Logging_KVFieldF32((key), (float)(value))
+#define KV_STR(key, value) Logging_KVFieldStr((key), (value))
+#define KV_BOOL(key, value) Logging_KVFieldBool((key), (value))
+
+/*
+ * Fields are collected into a block scope compound literal. A leading unused
+ * entry keeps the initializer valid for events without fields; the count is
+ * taken with sizeof, which does not evaluate the arguments a second time.
+ */
+#define LOGGING_KV_FIELDS(...) ((const Logging_KVField_t[]){ { 0, { 0 }, LOGGING_KV_TYPE_NONE }, ##__VA_ARGS__ })
+#define LOGGING_KV_COUNT(...) ((sizeof(LOGGING_KV_FIELDS(__VA_ARGS__)) / sizeof(Logging_KVField_t)) - 1u)
+
+#define LOGGING_KV_EMIT(level, event, ...)                                             \
+    Logging_KVLog((uint8_t)(level), (uint16_t)(LOGGING_MODULE_ID), (uint16_t)__LINE__, \
+                  (event), LOGGING_KV_FIELDS(__VA_ARGS__) + 1, LOGGING_KV_COUNT(__VA_ARGS__))
+
+#if defined(LOGGING_RUNTIME_FILTER)
+#define LOGGING_KV_ENABLED(level) LOGGING_RUNTIME_ENABLED(level)
+#else
+#define LOGGING_KV_ENABLED(level) 1
+#endif
+
+#define LOG_KV_AT_LEVEL(level, event, ...)                       \
+    do                                                           \
+    {                                                            \
+        LOGGING_SITE(level);                                     \
+        if (LOGGING_SITE_ENABLED() && LOGGING_KV_ENABLED(level)) \
+        {                                                        \
+            LOGGING_STATS_EMITTED(level);                        \
+            LOGGING_KV_EMIT(level, event, ##__VA_ARGS__);        \
+        }                                                        \
+    } while (0)
+
+/* Same compile-time ceiling as the text macros */
+#if defined(LOGGING_DISABLED_GLOBALLY)
+#define LogErrorKV(event, ...)
+#define LogWarnKV(event, ...)
+#define LogInfoKV(event, ...)
+#define LogDebugKV(event, ...)
+#else
+#if LOGGING_TOP_LOG_LEVEL >= LOG_ERROR
+#define LogErrorKV(event, ...) LOG_KV_AT_LEVEL(LOG_ERROR, event, ##__VA_ARGS__)
+#else
+#define LogErrorKV(event, ...)
+#endif
+#if LOGGING_TOP_LOG_LEVEL >= LOG_WARN
+#define LogWarnKV(event, ...) LOG_KV_AT_LEVEL(LOG_WARN, event, ##__VA_ARGS__)
+#else
+#define LogWarnKV(event, ...)
+#endif
+#if LOGGING_TOP_LOG_LEVEL >= LOG_INFO
+#define LogInfoKV(event, ...) LOG_KV_AT_LEVEL(LOG_INFO, event, ##__VA_ARGS__)
+#else
+#define LogInfoKV(event, ...)
+#endif
+#if LOGGING_TOP_LOG_LEVEL >= LOG_DEBUG
+#define LogDebugKV(event, ...) LOG_KV_AT_LEVEL(LOG_DEBUG, event, ##__VA_ARGS__)
+#else
+#define LogDebugKV(event, ...)
+#endif
+#endif
+
+#endif /* LOGGING_KV */
+
+#endif /* LOGGING_KV_H */
@@ -90,4 +90,15 @@
  */
 #define LOG_DEBUG    4
 
+/**
+ * @brief Level of a message from its leading tag ("[ERROR] ", "[WARN]  ", ...).
+ *
+ * Folded at compile time for string literals. Used where only the composed
+ * message is at hand, e.g. to count or prioritize a record per level.
+ */
+#define LOGGING_TAG_LEVEL(message)                   \
+    (((message)[1] == 'E') ? LOG_ERROR :             \
+     ((message)[1] == 'W') ? LOG_WARN :              \
+     ((message)[1] == 'I') ? LOG_INFO : LOG_DEBUG)
+
 #endif /* ifndef LOGGING_LEVELS_H */
@@ -0,0 +1,93 @@
+/**
+ * @file: logging_module.h
+ * @author: Paweł Kawula (pawel.kawula@kelectronics.pl)
+ * @brief: Compile-time module identifier derived from LOGGING_LOG_NAME
+ * -----
+ * Copyright 2025 - KElectronics
+ * -----
+ * @note: LOGGING_LOG_NAME is reduced to a 16-bit LOGGING_MODULE_ID by a hash
+ *        folded into a static constant, so no code runs for it even at -O0.
+ *        Structured records and the statistics counters carry the ID instead
+ *        of the name; host tools recompute it from the name with the same hash.
+ */
+
+#ifndef LOGGING_MODULE_H
+#define LOGGING_MODULE_H
+
+#include <stdint.h>
+
+/**
+ * @brief Number of leading characters of the module name covered by the hash.
+ */
+#define LOGGING_MODULE_HASH_LENGTH 32
+
+/*
+ * Same 65599 polynomial as LOGGING_TOKEN_HASH(), over the first
+ * LOGGING_MODULE_HASH_LENGTH characters and seeded with the name length.
+ */
+#define LOGGING_MODULE_HASH_CHAR(s, i) \
+    ((uint32_t)((i) < sizeof(s) - 1u ? (unsigned char)(s)[(i) < sizeof(s) ? (i) : 0] : 0u))
+
+#define LOGGING_MODULE_HASH(s) \
+    ((uint32_t)(sizeof(s) - 1u) + \
+     LOGGING_MODULE_HASH_CHAR(s, 0) * 0x0001003Fu + \
+     LOGGING_MODULE_HASH_CHAR(s, 1) * 0x007E0F81u + \
+     LOGGING_MODULE_HASH_CHAR(s, 2) * 0x2E86D0BFu + \
+     LOGGING_MODULE_HASH_CHAR(s, 3) * 0x43EC5F01u + \
+     LOGGING_MODULE_HASH_CHAR(s, 4) * 0x162C613Fu + \
+     LOGGING_MODULE_HASH_CHAR(s, 5) * 0xD62AEE81u + \
+     LOGGING_MODULE_HASH_CHAR(s, 6) * 0xA311B1BFu + \
+     LOGGING_MODULE_HASH_CHAR(s, 7) * 0xD319BE01u + \
+     LOGGING_MODULE_HASH_CHAR(s, 8) * 0xB156C23Fu + \
+     LOGGING_MODULE_HASH_CHAR(s, 9) * 0x6698CD81u + \
+     LOGGING_MODULE_HASH_CHAR(s, 10) * 0x0D1B92BFu + \
+     LOGGING_MODULE_HASH_CHAR(s, 11) * 0xCC881D01u + \
+     LOGGING_MODULE_HASH_CHAR(s, 12) * 0x7280233Fu + \
+     LOGGING_MODULE_HASH_CHAR(s, 13) * 0x50C7AC81u + \
+     LOGGING_MODULE_HASH_CHAR(s, 14) * 0x8DA473BFu + \
+     LOGGING_MODULE_HASH_CHAR(s, 15) * 0x4F377C01u + \
+     LOGGING_MODULE_HASH_CHAR(s, 16) * 0xFAA8843Fu + \
+     LOGGING_MODULE_HASH_CHAR(s, 17) * 0x33B78B81u + \
+     LOGGING_MODULE_HASH_CHAR(s, 18) * 0x45AC54BFu + \
+     LOGGING_MODULE_HASH_CHAR(s, 19) * 0x7A27DB01u + \
+     LOGGING_MODULE_HASH_CHAR(s, 20) * 0xEACFE53Fu + \
+     LOGGING_MODULE_HASH_CHAR(s, 21) * 0xAE686A81u + \
+     LOGGING_MODULE_HASH_CHAR(s, 22) * 0x563335BFu + \
+     LOGGING_MODULE_HASH_CHAR(s, 23) * 0x6C593A01u + \
+     LOGGING_MODULE_HASH_CHAR(s, 24) * 0xE3F6463Fu + \
+     LOGGING_MODULE_HASH_CHAR(s, 25) * 0x5FDA4981u + \
+     LOGGING_MODULE_HASH_CHAR(s, 26) * 0xE03916BFu + \
+     LOGGING_MODULE_HASH_CHAR(s, 27) * 0x44CB9901u + \
+     LOGGING_MODULE_HASH_CHAR(s, 28) * 0x871BA73Fu + \
+     LOGGING_MODULE_HASH_CHAR(s, 29) * 0xE70D2881u + \
+     LOGGING_MODULE_HASH_CHAR(s, 30) * 0x04BDF7BFu + \
+     LOGGING_MODULE_HASH_CHAR(s, 31) * 0x227EF801u)
+
+/* 1..65535 - ID 0 is left for code compiled without LOGGING_LOG_NAME */
+#define LOGGING_MODULE_ID_OF(s) ((uint16_t)((LOGGING_MODULE_HASH(s) % 65535u) + 1u))
+
+/**
+ * @brief Module identifier of the translation unit.
+ *
+ * Hashed from LOGGING_LOG_NAME unless given explicitly (e.g. to keep IDs
+ * stable across renames); 0 for code compiled without a name.
+ */
+#ifndef LOGGING_MODULE_ID
+#ifdef LOGGING_LOG_NAME
+static const uint16_t logging_module_id_ __attribute__((unused)) = LOGGING_MODULE_ID_OF(LOGGING_LOG_NAME);
+#define LOGGING_MODULE_ID logging_module_id_
+#else
+#define LOGGING_MODULE_ID 0u
+#endif
+#endif
+
+/**
+ * @brief Module name of the translation unit, "" for unnamed code.
+ */
+#ifdef LOGGING_LOG_NAME
+#define LOGGING_MODULE_NAME LOGGING_LOG_NAME
+#else
+#define LOGGING_MODULE_NAME ""
+#endif
+
+#endif /* LOGGING_MODULE_H */
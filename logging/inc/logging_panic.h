@@ -0,0 +1,77 @@
+/**
+ * @file: logging_panic.h
+ * @author: Paweł Kawula (pawel.kawula@kelectronics.pl)
+ * @brief: Panic mode - synchronous polled output and drain of the buffered stages
+ * -----
+ * Copyright 2025 - KElectronics
+ * -----
+ * @note: Enabled with LOGGING_PANIC. The buffered stages (deferred ring, DMA
+ *        halves, batches) keep the call sites fast, but a LogError() right
+ *        before a reset may still sit in RAM when the core stops.
+ *        Logging_EnterPanic() writes everything pending to a minimal polled
+ *        writer and routes every later message straight to it, formatted
+ *        in the calling context.
+ */
+
+#ifndef LOGGING_PANIC_H
+#define LOGGING_PANIC_H
+
+#ifdef LOGGING_PANIC
+
+#include "logging_types.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * @brief Switch to synchronous output through panic_write and drain the buffered stages.
+ *
+ * Pending records are written oldest first: the half of the DMA stage
+ * being filled, the partial batch, then the deferred ring through the
+ * built-in formatter. Afterwards the log macros format on the caller's
+ * stack and call panic_write before returning; deferred messages are
+ * queued and drained by the same call. Tokenized frames and key/value
+ * records go to panic_write too, scope tracing stops.
+ *
+ * There is no way back, the next step is a reset. Call from the fault
+ * handler with interrupts disabled; contexts interrupted inside the
+ * logging stages are not waited for, so a record may appear twice.
+ *
+ * @param panic_write Polled writer, must not wait for interrupts or DMA. NULL is ignored.
+ *
+ * @example
+ * @code
+ * static int uart_polled_write(const uint8_t *data, size_t length) {
+ *     for (size_t i = 0; i < length; i++) {
+ *         while (!(USART2->ISR & USART_ISR_TXE)) {}
+ *         USART2->TDR = data[i];
+ *     }
+ *     return (int)length;
+ * }
+ *
+ * void HardFault_Handler(void) {
+ *     __disable_irq();
+ *     Logging_EnterPanic(uart_polled_write);
+ *     LogError("Hard fault, CFSR 0x%08lx", SCB->CFSR);
+ *     NVIC_SystemReset();
+ * }
+ * @endcode
+ */
+void Logging_EnterPanic(Logging_WriteFunction_t panic_write);
+
+/**
+ * @brief Check whether Logging_EnterPanic() was called.
+ *
+ * @return int 1 in panic mode, 0 otherwise.
+ */
+int Logging_InPanic(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LOGGING_PANIC */
+
+#endif /* LOGGING_PANIC_H */
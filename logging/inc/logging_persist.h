@@ -0,0 +1,98 @@
+/**
+ * @file: logging_persist.h
+ * @author: Paweł Kawula (pawel.kawula@kelectronics.pl)
+ * @brief: Crash-safe log of recent messages in retained (.noinit) RAM
+ * -----
+ * Copyright 2025 - KElectronics
+ * -----
+ * @note: Enabled with LOGGING_PERSIST. Logging_PersistWrite() keeps the last
+ *        LOGGING_PERSIST_RECORDS messages in a RAM region that the startup
+ *        code does not clear (linker/logging_persist.ld). After a fault and
+ *        reset, Logging_RecoverPersisted() validates the region (magic + CRC)
+ *        and replays the messages through the registered logging function.
+ *        Writes are plain memory stores - no flash erase or program cycles.
+ */
+
+#ifndef LOGGING_PERSIST_H
+#define LOGGING_PERSIST_H
+
+#ifdef LOGGING_PERSIST
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Number of messages kept, the oldest is overwritten first.
+ */
+#ifndef LOGGING_PERSIST_RECORDS
+#define LOGGING_PERSIST_RECORDS 32
+#endif
+
+/**
+ * @brief Bytes per record including the record header, longer messages are truncated.
+ */
+#ifndef LOGGING_PERSIST_RECORD_SIZE
+#define LOGGING_PERSIST_RECORD_SIZE 64
+#endif
+
+/**
+ * @brief Section of the retained region, must not be zeroed by the startup code.
+ */
+#ifndef LOGGING_PERSIST_SECTION
+#define LOGGING_PERSIST_SECTION ".noinit"
+#endif
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * @brief Store one formatted message in the retained region.
+ *
+ * Has the Logging_WriteFunction_t signature, so it can be registered as a
+ * sink directly (e.g. Logging_AddSink(Logging_PersistWrite, LOGGING_LEVELS_UP_TO(LOG_WARN)))
+ * or called from an own sink with the bytes it already formatted.
+ *
+ * @param data   Message bytes.
+ * @param length Number of bytes, truncated to the record size.
+ * @return int Number of bytes stored, -1 when another context is writing
+ *             or Logging_RecoverPersisted() is replaying.
+ */
+int Logging_PersistWrite(const uint8_t *data, size_t length);
+
+/**
+ * @brief Replay the messages retained from before the last reset, then clear them.
+ *
+ * Call once at boot after the logging output is initialized. Each message is
+ * passed to the registered logging function as "%s" with the recorded text,
+ * oldest first. A region with a bad magic or CRC (power-on, corrupted RAM)
+ * is cleared without replay.
+ *
+ * @return size_t Number of messages replayed.
+ *
+ * @example
+ * @code
+ * int main(void) {
+ *     Logging_InitWrite(uart_write);
+ *     if (Logging_RecoverPersisted() > 0) {
+ *         LogWarn("Previous run ended with the messages above");
+ *     }
+ *     Logging_AddSink(Logging_PersistWrite, LOGGING_LEVELS_UP_TO(LOG_WARN));
+ * }
+ * @endcode
+ */
+size_t Logging_RecoverPersisted(void);
+
+/**
+ * @brief Discard all retained messages.
+ */
+void Logging_PersistClear(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LOGGING_PERSIST */
+
+#endif /* LOGGING_PERSIST_H */
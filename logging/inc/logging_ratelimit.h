@@ -0,0 +1,128 @@
+/**
+ * @file: logging_ratelimit.h
+ * @author: Paweł Kawula (pawel.kawula@kelectronics.pl)
+ * @brief: Per call site rate limiting with suppressed message summary
+ * -----
+ * Copyright 2025 - KElectronics
+ * -----
+ * @note: Enabled with LOGGING_RATE_LIMIT. Every macro expansion owns a static
+ *        window state, so no lookup is needed. A site printing more than
+ *        LOGGING_RATE_LIMIT_BURST messages per window is muted until the next
+ *        window, which starts with a "suppressed N times" line from that site.
+ */
+
+#ifndef LOGGING_RATELIMIT_H
+#define LOGGING_RATELIMIT_H
+
+#ifdef LOGGING_RATE_LIMIT
+
+#include <inttypes.h>
+#include <stdint.h>
+
+/**
+ * @brief Messages allowed per call site in one window.
+ */
+#ifndef LOGGING_RATE_LIMIT_BURST
+#define LOGGING_RATE_LIMIT_BURST 10u
+#endif
+
+/**
+ * @brief Window length in LOGGING_RATE_LIMIT_CLOCK() units.
+ */
+#ifndef LOGGING_RATE_LIMIT_WINDOW
+#define LOGGING_RATE_LIMIT_WINDOW 1000u
+#endif
+
+/**
+ * @brief Clock read by rate limited sites, milliseconds by default.
+ *
+ * Defaults to calling Logging_GetMilliseconds(), provided by the application
+ * (e.g. xTaskGetTickCount() with a 1 kHz tick, or HAL_GetTick()).
+ */
+#ifndef LOGGING_RATE_LIMIT_CLOCK
+#define LOGGING_RATE_LIMIT_CLOCK() Logging_GetMilliseconds()
+#endif
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * @brief Rate limiter state of one call site.
+ */
+typedef struct
+{
+    uint32_t window_start;
+    uint32_t count;
+    uint32_t suppressed;
+} Logging_RateLimit_t;
+
+/**
+ * @brief Default clock hook, implemented by the application when
+ *        LOGGING_RATE_LIMIT_CLOCK() is not defined.
+ *
+ * @return uint32_t Monotonic time in milliseconds (wrap-around is handled).
+ */
+uint32_t Logging_GetMilliseconds(void);
+
+/**
+ * @brief Account one message of a call site.
+ *
+ * @param site       Static state of the call site.
+ * @param now        Current LOGGING_RATE_LIMIT_CLOCK() value.
+ * @param suppressed Set to the number of messages muted in the previous window
+ *                   when this call opens a new window, 0 otherwise.
+ * @return int 1 when the message may be printed, 0 when it is suppressed.
+ *
+ * @note State is updated without locking; concurrent use of one site can
+ *       only skew the counters.
+ */
+static inline int Logging_RateLimitPass(Logging_RateLimit_t *site, uint32_t now, uint32_t *suppressed)
+{
+    if ((site->count == 0u) || ((uint32_t)(now - site->window_start) >= LOGGING_RATE_LIMIT_WINDOW))
+    {
+        *suppressed = site->suppressed;
+        site->window_start = now;
+        site->count = 0u;
+        site->suppressed = 0u;
+    }
+
+    if (site->count < LOGGING_RATE_LIMIT_BURST)
+    {
+        site->count++;
+        return 1;
+    }
+
+    site->suppressed++;
+    return 0;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* Rate limited emission, the summary shares the tag and line of the site */
+#define LOG_RATE_LIMITED(level, tag, message, ...)                                                 \
+    do                                                                                             \
+    {                                                                                              \
+        static Logging_RateLimit_t logging_rate_;                                                  \
+        uint32_t logging_suppressed_ = 0u;                                                         \
+        if (Logging_RateLimitPass(&logging_rate_, (uint32_t)(LOGGING_RATE_LIMIT_CLOCK()),          \
+                                  &logging_suppressed_))                                           \
+        {                                                                                          \
+            if (LOGGING_UNLIKELY(logging_suppressed_ != 0u))                                       \
+            {                                                                                      \
+                LOG_WITH_FUNC(tag, "suppressed %" PRIu32 " times", logging_suppressed_);           \
+            }                                                                                      \
+            LOG_WITH_FUNC(tag, message, ##__VA_ARGS__);                                            \
+        }                                                                                          \
+        else                                                                                       \
+        {                                                                                          \
+            LOGGING_STATS_DROPPED(level);                                                          \
+        }                                                                                          \
+    } while (0)
+
+#endif /* LOGGING_RATE_LIMIT */
+
+#endif /* LOGGING_RATELIMIT_H */
@@ -0,0 +1,103 @@
+/**
+ * @file: logging_sinks.h
+ * @author: Paweł Kawula (pawel.kawula@kelectronics.pl)
+ * @brief: Multi-sink fan-out with per-sink level masks
+ * -----
+ * Copyright 2025 - KElectronics
+ * -----
+ * @note: Enabled with LOGGING_MULTI_SINK. Each message is formatted once into
+ *        a buffer on the caller's stack and the resulting bytes are handed to
+ *        every registered sink whose level mask contains the message level.
+ *        Fixed capacity table, no heap.
+ */
+
+#ifndef LOGGING_SINKS_H
+#define LOGGING_SINKS_H
+
+#ifdef LOGGING_MULTI_SINK
+
+#include <stdint.h>
+
+#include "logging_levels.h"
+#include "logging_types.h"
+
+/**
+ * @brief Number of slots in the sink table.
+ */
+#ifndef LOGGING_MAX_SINKS
+#define LOGGING_MAX_SINKS 4
+#endif
+
+/**
+ * @brief Stack buffer a message is formatted into, shared by every sink.
+ *
+ * Longer messages are truncated, keeping the trailing "\r\n".
+ */
+#ifndef LOGGING_SINK_BUFFER_SIZE
+#define LOGGING_SINK_BUFFER_SIZE 128
+#endif
+
+/* Level mask helpers */
+#define LOGGING_LEVEL_MASK(level) ((uint8_t)(1u << (level)))
+#define LOGGING_LEVELS_UP_TO(level) ((uint8_t)(((1u << ((level) + 1u)) - 1u) & ~1u))
+#define LOGGING_ALL_LEVELS LOGGING_LEVELS_UP_TO(LOG_DEBUG)
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * @brief Register an output in the sink table.
+ *
+ * The first registered sink switches the log macros to the sink table; a
+ * later Logging_Init() or Logging_InitV() switches back to a single function.
+ * Messages without a level tag are delivered to every sink.
+ *
+ * @param write_func Function receiving the formatted message (NUL terminated, length without NUL).
+ * @param level_mask Levels delivered to this sink, built from LOGGING_LEVEL_MASK() / LOGGING_LEVELS_UP_TO().
+ * @return int Slot index, -1 when the table is full or write_func is NULL.
+ *
+ * @example
+ * @code
+ * Logging_AddSink(flash_log_write, LOGGING_LEVEL_MASK(LOG_ERROR));
+ * Logging_AddSink(uart_write, LOGGING_LEVELS_UP_TO(LOG_WARN));
+ * Logging_AddSink(rtt_write, LOGGING_ALL_LEVELS);
+ * @endcode
+ */
+int Logging_AddSink(Logging_WriteFunction_t write_func, uint8_t level_mask);
+
+/**
+ * @brief Remove an output from the sink table.
+ *
+ * @param write_func Function previously passed to Logging_AddSink().
+ * @return int 0 on success, -1 when the function is not registered.
+ */
+int Logging_RemoveSink(Logging_WriteFunction_t write_func);
+
+/**
+ * @brief Change the level mask of a registered sink.
+ *
+ * @param write_func Function previously passed to Logging_AddSink().
+ * @param level_mask New level mask.
+ * @return int 0 on success, -1 when the function is not registered.
+ */
+int Logging_SetSinkMask(Logging_WriteFunction_t write_func, uint8_t level_mask);
+
+/**
+ * @brief Get the number of deliveries a sink did not accept.
+ *
+ * Counts every write that returned 0 or less (an output dropping the record,
+ * e.g. a full ring), once per sink.
+ *
+ * @return uint32_t Refused delivery counter since startup.
+ */
+uint32_t Logging_GetSinkDropped(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LOGGING_MULTI_SINK */
+
+#endif /* LOGGING_SINKS_H */
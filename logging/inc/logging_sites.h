@@ -0,0 +1,133 @@
+/**
+ * @file: logging_sites.h
+ * @author: Paweł Kawula (pawel.kawula@kelectronics.pl)
+ * @brief: Per call site enable switches, collected in a linker section
+ * -----
+ * Copyright 2025 - KElectronics
+ * -----
+ * @note: Enabled with LOGGING_SITES. Every log macro expansion defines a
+ *        static Logging_Site_t (file, line, level, enabled byte) placed in the
+ *        logging_sites section, so the application can enumerate all sites
+ *        and switch single ones on or off at runtime, e.g. from a debug
+ *        console. A disabled site costs one byte load and a branch; its
+ *        arguments are not evaluated.
+ */
+
+#ifndef LOGGING_SITES_H
+#define LOGGING_SITES_H
+
+#ifdef LOGGING_SITES
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Sites with a level at or below this one start enabled.
+ *
+ * Defaults to the compile-time ceiling (no change in output). Use e.g.
+ * LOG_INFO to ship LOG_DEBUG messages compiled in but switched off.
+ */
+#ifndef LOGGING_SITES_DEFAULT_LEVEL
+#define LOGGING_SITES_DEFAULT_LEVEL LOGGING_TOP_LOG_LEVEL
+#endif
+
+/*
+ * Section of the site table. A valid C identifier, so GNU ld and LLD define
+ * __start_logging_sites / __stop_logging_sites on hosted targets; embedded
+ * linker scripts add the entry from linker/logging_sites.ld.
+ */
+#define LOGGING_SITES_SECTION "logging_sites"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * @brief One log call site. Lives in RAM, only enabled is written at runtime.
+ */
+typedef struct
+{
+    const char *file;         /**< LOGGING_FILE_NAME of the call site */
+    uint16_t line;            /**< __LINE__ of the call site */
+    uint8_t level;            /**< LOG_ERROR ... LOG_DEBUG */
+    volatile uint8_t enabled; /**< Read by the call site before anything else */
+} Logging_Site_t;
+
+/**
+ * @brief Get the number of log call sites linked into the image.
+ *
+ * Site ids are 0 .. count - 1, in link order: stable for one build, not
+ * across builds. Enumerate by file and line to find a site.
+ *
+ * @return size_t Number of sites.
+ */
+size_t Logging_GetSiteCount(void);
+
+/**
+ * @brief Get the description of a call site.
+ *
+ * @param id Site id (0 .. Logging_GetSiteCount() - 1).
+ * @return const Logging_Site_t* Site, NULL when id is out of range.
+ *
+ * @example
+ * @code
+ * // Debug console "sites" command
+ * for (size_t id = 0; id < Logging_GetSiteCount(); id++) {
+ *     const Logging_Site_t *site = Logging_GetSite(id);
+ *     console_printf("%3u %s:%u %s %s\n", (unsigned)id, site->file, site->line,
+ *                    Logging_GetLoggingLevelName(site->level), site->enabled ? "on" : "off");
+ * }
+ * @endcode
+ */
+const Logging_Site_t *Logging_GetSite(size_t id);
+
+/**
+ * @brief Switch one call site on or off.
+ *
+ * @param id Site id (0 .. Logging_GetSiteCount() - 1).
+ * @param on Nonzero to enable.
+ * @return int 0 on success, -1 when id is out of range.
+ */
+int Logging_SetSiteEnabled(size_t id, int on);
+
+/**
+ * @brief Switch the call sites of a source file, or one line of it, on or off.
+ *
+ * @param file File name as stored in the sites (LOGGING_FILE_NAME), NULL for all files.
+ * @param line Line of the call site, 0 for every line.
+ * @param on   Nonzero to enable.
+ * @return size_t Number of sites changed.
+ *
+ * @example
+ * @code
+ * Logging_SetSitesEnabled("can_driver.c", 212, 1);   // Just this one LogDebug
+ * @endcode
+ */
+size_t Logging_SetSitesEnabled(const char *file, unsigned line, int on);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LOGGING_SITES */
+
+#if defined(LOGGING_SITES) && !defined(LOGGING_DISABLED_GLOBALLY)
+
+/* Static site of the current macro expansion, checked by LOGGING_SITE_ENABLED() */
+#define LOGGING_SITE(level)                                                                        \
+    static Logging_Site_t logging_site_ __attribute__((section(LOGGING_SITES_SECTION), used)) = {  \
+        LOGGING_FILE_NAME, (uint16_t)__LINE__, (uint8_t)(level),                                   \
+        (uint8_t)(((level) <= LOGGING_SITES_DEFAULT_LEVEL) ? 1u : 0u)                              \
+    }
+
+#define LOGGING_SITE_ENABLED() LOGGING_LIKELY(logging_site_.enabled != 0u)
+
+#else
+
+#define LOGGING_SITE(level) (void)0
+#define LOGGING_SITE_ENABLED() 1
+
+#endif /* LOGGING_SITES && !LOGGING_DISABLED_GLOBALLY */
+
+#endif /* LOGGING_SITES_H */
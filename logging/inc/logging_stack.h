@@ -13,53 +13,206 @@
 #define LOGGING_STACK_H
 
 #include "logging_levels.h"
+#include "logging_types.h"
+
+/* Branch hints */
+#if defined(__GNUC__) || defined(__clang__)
+#define LOGGING_LIKELY(x) __builtin_expect(!!(x), 1)
+#define LOGGING_UNLIKELY(x) __builtin_expect(!!(x), 0)
+#else
+#define LOGGING_LIKELY(x) (x)
+#define LOGGING_UNLIKELY(x) (x)
+#endif
+
+/* Argument counting (0..8) */
+#define LOGGING_NARGS(...) LOGGING_NARGS_(0, ##__VA_ARGS__, 8, 7, 6, 5, 4, 3, 2, 1, 0)
+#define LOGGING_NARGS_(_0, _1, _2, _3, _4, _5, _6, _7, _8, N, ...) N
+
+#define LOGGING_CONCAT(a, b) LOGGING_CONCAT2(a, b)
+#define LOGGING_CONCAT2(a, b) a##b
+
+#include "logging_format.h"
+
+#include "logging_deferred.h"
+
+#include "logging_filter.h"
+#include "logging_module.h"
+#include "logging_ratelimit.h"
+#include "logging_sites.h"
+#include "logging_stats.h"
+#include "logging_timestamp.h"
+#include "logging_tokens.h"
 
 #define LOGGING_STRINGIZE(x) LOGGING_STRINGIZE2(x)
 #define LOGGING_STRINGIZE2(x) #x
 #define LOGGING_LINE_STRING LOGGING_STRINGIZE(__LINE__)
 
-#ifndef FILE_NAME
-#define FILE_NAME ""
+#if defined(LOGGING_PRINT_FILE_PATH) && defined(LOGGING_PRINT_FILE_NAME)
+#error "LOGGING_PRINT_FILE_PATH and LOGGING_PRINT_FILE_NAME are mutually exclusive."
 #endif
 
-/* Compile-time string concatenation */
-#ifdef LOGGING_LOG_NAME
-#ifdef LOGGING_PRINT_FILE_PATH
-#define LOG_PREFIX "[" LOGGING_LOG_NAME "] (" __FILE__ ") "
+/*
+ * Basename for LOGGING_PRINT_FILE_NAME, in order of preference: the compiler's
+ * __FILE_NAME__ (GCC 12+, Clang 9+), FILE_NAME set per source file for older
+ * compilers (logging_set_file_names() in CMake), the full __FILE__ as a last
+ * resort.
+ */
+#if defined(__FILE_NAME__)
+#define LOGGING_FILE_NAME __FILE_NAME__
+#elif defined(FILE_NAME)
+#define LOGGING_FILE_NAME FILE_NAME
 #else
-#define LOG_PREFIX "[" LOGGING_LOG_NAME "] "
+#define LOGGING_FILE_NAME __FILE__
 #endif
+
+#if defined(LOGGING_PRINT_FILE_PATH)
+#define LOGGING_FILE_SLOT "(" __FILE__ ") "
+#elif defined(LOGGING_PRINT_FILE_NAME)
+#define LOGGING_FILE_SLOT "(" LOGGING_FILE_NAME ") "
 #else
-#ifdef LOGGING_PRINT_FILE_PATH
-#define LOG_PREFIX "(" __FILE__ ") "
-#else
-#define LOG_PREFIX ""
+#define LOGGING_FILE_SLOT ""
 #endif
+
+/* Compile-time string concatenation */
+#ifdef LOGGING_LOG_NAME
+#define LOG_PREFIX "[" LOGGING_LOG_NAME "] " LOGGING_FILE_SLOT
+#else
+#define LOG_PREFIX LOGGING_FILE_SLOT
 #endif
 
 #define LOG_SUFFIX ":" LOGGING_LINE_STRING " - "
 
-/* Function name optimization */
-#ifdef LOGGING_PRINT_FUNCTION_NAME
+/* Function name optimization, timestamp (when enabled) is always the first argument */
+#if defined(LOGGING_PRINT_FUNCTION_NAME) && defined(LOGGING_TIMESTAMP)
+#define LOG_WITH_FUNC(level, message, ...)                                                  \
+    SdkLog(level LOG_TIMESTAMP_SLOT LOG_PREFIX "(%s)" LOG_SUFFIX message "\r\n",           \
+           LOG_TIMESTAMP_NOW(), __func__, ##__VA_ARGS__)
+#elif defined(LOGGING_PRINT_FUNCTION_NAME)
 #define LOG_WITH_FUNC(level, message, ...) \
     SdkLog(level LOG_PREFIX "(%s)" LOG_SUFFIX message "\r\n", __func__, ##__VA_ARGS__)
-#define LOG_WITHOUT_FUNC(level, message, ...) \
-    LOG_WITH_FUNC(level, message, ##__VA_ARGS__)
+#elif defined(LOGGING_TIMESTAMP)
+#define LOG_WITH_FUNC(level, message, ...) \
+    SdkLog(level LOG_TIMESTAMP_SLOT LOG_PREFIX LOG_SUFFIX message "\r\n", LOG_TIMESTAMP_NOW(), ##__VA_ARGS__)
 #else
 #define LOG_WITH_FUNC(level, message, ...) \
     SdkLog(level LOG_PREFIX LOG_SUFFIX message "\r\n", ##__VA_ARGS__)
+#endif
 #define LOG_WITHOUT_FUNC(level, message, ...) \
     LOG_WITH_FUNC(level, message, ##__VA_ARGS__)
-#endif
 
 extern int (*log_function)(const char *message, ...);
 
+/* Sink read with acquire semantics, pairs with the release store of Logging_Init() / Logging_SwapSink() */
+#if defined(__GNUC__) || defined(__clang__)
+#define LOGGING_CURRENT_SINK() __atomic_load_n(&log_function, __ATOMIC_ACQUIRE)
+#else
+#define LOGGING_CURRENT_SINK() log_function
+#endif
+
 #if !defined(LOGGING_DISABLED_GLOBALLY)
-#define SdkLog(message, ...) log_function(message, ##__VA_ARGS__)
+#if defined(LOGGING_DEFERRED)
+#define SdkLog(message, ...) LOGGING_DEFER(message, ##__VA_ARGS__)
+#elif defined(LOGGING_TOKENIZED)
+#define SdkLog(message, ...) LOGGING_TOKENIZE(message, ##__VA_ARGS__)
+#else
+#define SdkLog(message, ...) \
+    (LOGGING_CHECK_FORMAT(message, ##__VA_ARGS__), LOGGING_CURRENT_SINK()(message, ##__VA_ARGS__))
+#endif
 #else
 #define SdkLog(message, ...)
 #endif
 
+/* Per call site rate limiting */
+#if defined(LOGGING_RATE_LIMIT) && !defined(LOGGING_DISABLED_GLOBALLY)
+#define LOG_EMIT(level, tag, message, ...) LOG_RATE_LIMITED(level, tag, message, ##__VA_ARGS__)
+#else
+#define LOG_EMIT(level, tag, message, ...) LOG_WITH_FUNC(tag, message, ##__VA_ARGS__)
+#endif
+
+/*
+ * Arguments are evaluated only when the message is really produced: never for
+ * levels above LOGGING_TOP_LOG_LEVEL (the call is removed), never when the
+ * call site is switched off, the runtime filter rejects the level, the rate
+ * limiter mutes the site or the deferred ring is full. Format and type checks are unevaluated operands.
+ */
+
+/* Runtime level filter (levels above LOGGING_TOP_LOG_LEVEL never reach this point) */
+#if defined(LOGGING_RUNTIME_FILTER) && !defined(LOGGING_DISABLED_GLOBALLY)
+#define LOG_FILTERED(level, tag, message, ...)             \
+    do                                                     \
+    {                                                      \
+        if (LOGGING_RUNTIME_ENABLED(level))                \
+        {                                                  \
+            LOGGING_STATS_EMITTED(level);                  \
+            LOG_EMIT(level, tag, message, ##__VA_ARGS__);  \
+        }                                                  \
+    } while (0)
+#elif defined(LOGGING_STATS) && !defined(LOGGING_DISABLED_GLOBALLY)
+#define LOG_FILTERED(level, tag, message, ...)             \
+    do                                                     \
+    {                                                      \
+        LOGGING_STATS_EMITTED(level);                      \
+        LOG_EMIT(level, tag, message, ##__VA_ARGS__);      \
+    } while (0)
+#else
+#define LOG_FILTERED(level, tag, message, ...) LOG_EMIT(level, tag, message, ##__VA_ARGS__)
+#endif
+
+/* Per call site switch (LOGGING_SITES), one byte load before the runtime filter */
+#if defined(LOGGING_SITES) && !defined(LOGGING_DISABLED_GLOBALLY)
+#define LOG_AT_LEVEL(level, tag, message, ...)                 \
+    do                                                         \
+    {                                                          \
+        LOGGING_SITE(level);                                   \
+        if (LOGGING_SITE_ENABLED())                            \
+        {                                                      \
+            LOG_FILTERED(level, tag, message, ##__VA_ARGS__);  \
+        }                                                      \
+    } while (0)
+#else
+#define LOG_AT_LEVEL(level, tag, message, ...) LOG_FILTERED(level, tag, message, ##__VA_ARGS__)
+#endif
+
+/**
+ * @brief Check whether messages of a level are currently produced by this translation unit.
+ *
+ * Constant 0 for levels above LOGGING_TOP_LOG_LEVEL (the guarded code is
+ * removed by the compiler), one byte load and compare with the runtime filter.
+ *
+ * @example
+ * @code
+ * if (LOG_ENABLED(LOG_DEBUG)) {
+ *     char dump[64];
+ *     format_state(ctx, dump, sizeof(dump));   // Never runs in production builds
+ *     LogDebug("state %s", dump);
+ * }
+ * @endcode
+ */
+#if defined(LOGGING_DISABLED_GLOBALLY)
+#define LOG_ENABLED(level) 0
+#elif defined(LOGGING_RUNTIME_FILTER)
+#define LOG_ENABLED(level) \
+    (((level) > LOG_NONE) && ((level) <= LOGGING_TOP_LOG_LEVEL) && LOGGING_RUNTIME_ENABLED(level))
+#else
+#define LOG_ENABLED(level) (((level) > LOG_NONE) && ((level) <= LOGGING_TOP_LOG_LEVEL))
+#endif
+
+/* Conditional message, cond is evaluated only after the level check passed */
+#if defined(LOGGING_DISABLED_GLOBALLY)
+#define LOG_IF_AT_LEVEL(level, tag, cond, message, ...)
+#else
+#define LOG_IF_AT_LEVEL(level, tag, cond, message, ...)             \
+    do                                                              \
+    {                                                               \
+        LOGGING_SITE(level);                                        \
+        if (LOGGING_SITE_ENABLED() && LOG_ENABLED(level) && (cond)) \
+        {                                                           \
+            LOGGING_STATS_EMITTED(level);                           \
+            LOG_EMIT(level, tag, message, ##__VA_ARGS__);           \
+        }                                                           \
+    } while (0)
+#endif
+
 /* Log level validation */
 #if !defined(LOGGING_TOP_LOG_LEVEL) ||       \
     ((LOGGING_TOP_LOG_LEVEL != LOG_NONE) &&  \
@@ -69,35 +222,56 @@ extern int (*log_function)(const char *message, ...);
      (LOGGING_TOP_LOG_LEVEL != LOG_DEBUG))
 #error "Please define LOGGING_TOP_LOG_LEVEL as either LOG_NONE, LOG_ERROR, LOG_WARN, LOG_INFO, or LOG_DEBUG."
 #else
+/* The level tag must stay first in the literal - buffered backends and the sink table read the level from it */
 #if LOGGING_TOP_LOG_LEVEL == LOG_DEBUG
-#define LogError(message, ...) LOG_WITH_FUNC("[ERROR] ", message, ##__VA_ARGS__)
-#define LogWarn(message, ...) LOG_WITH_FUNC("[WARN]  ", message, ##__VA_ARGS__)
-#define LogInfo(message, ...) LOG_WITH_FUNC("[INFO]  ", message, ##__VA_ARGS__)
-#define LogDebug(message, ...) LOG_WITH_FUNC("[DEBUG] ", message, ##__VA_ARGS__)
+#define LogError(message, ...) LOG_AT_LEVEL(LOG_ERROR, "[ERROR] ", message, ##__VA_ARGS__)
+#define LogErrorIf(cond, message, ...) LOG_IF_AT_LEVEL(LOG_ERROR, "[ERROR] ", cond, message, ##__VA_ARGS__)
+#define LogWarn(message, ...) LOG_AT_LEVEL(LOG_WARN, "[WARN]  ", message, ##__VA_ARGS__)
+#define LogWarnIf(cond, message, ...) LOG_IF_AT_LEVEL(LOG_WARN, "[WARN]  ", cond, message, ##__VA_ARGS__)
+#define LogInfo(message, ...) LOG_AT_LEVEL(LOG_INFO, "[INFO]  ", message, ##__VA_ARGS__)
+#define LogInfoIf(cond, message, ...) LOG_IF_AT_LEVEL(LOG_INFO, "[INFO]  ", cond, message, ##__VA_ARGS__)
+#define LogDebug(message, ...) LOG_AT_LEVEL(LOG_DEBUG, "[DEBUG] ", message, ##__VA_ARGS__)
+#define LogDebugIf(cond, message, ...) LOG_IF_AT_LEVEL(LOG_DEBUG, "[DEBUG] ", cond, message, ##__VA_ARGS__)
 
 #elif LOGGING_TOP_LOG_LEVEL == LOG_INFO
-#define LogError(message, ...) LOG_WITH_FUNC("[ERROR] ", message, ##__VA_ARGS__)
-#define LogWarn(message, ...) LOG_WITH_FUNC("[WARN]  ", message, ##__VA_ARGS__)
-#define LogInfo(message, ...) LOG_WITH_FUNC("[INFO]  ", message, ##__VA_ARGS__)
+#define LogError(message, ...) LOG_AT_LEVEL(LOG_ERROR, "[ERROR] ", message, ##__VA_ARGS__)
+#define LogErrorIf(cond, message, ...) LOG_IF_AT_LEVEL(LOG_ERROR, "[ERROR] ", cond, message, ##__VA_ARGS__)
+#define LogWarn(message, ...) LOG_AT_LEVEL(LOG_WARN, "[WARN]  ", message, ##__VA_ARGS__)
+#define LogWarnIf(cond, message, ...) LOG_IF_AT_LEVEL(LOG_WARN, "[WARN]  ", cond, message, ##__VA_ARGS__)
+#define LogInfo(message, ...) LOG_AT_LEVEL(LOG_INFO, "[INFO]  ", message, ##__VA_ARGS__)
+#define LogInfoIf(cond, message, ...) LOG_IF_AT_LEVEL(LOG_INFO, "[INFO]  ", cond, message, ##__VA_ARGS__)
 #define LogDebug(message, ...)
+#define LogDebugIf(cond, message, ...)
 
 #elif LOGGING_TOP_LOG_LEVEL == LOG_WARN
-#define LogError(message, ...) LOG_WITH_FUNC("[ERROR] ", message, ##__VA_ARGS__)
-#define LogWarn(message, ...) LOG_WITH_FUNC("[WARN]  ", message, ##__VA_ARGS__)
+#define LogError(message, ...) LOG_AT_LEVEL(LOG_ERROR, "[ERROR] ", message, ##__VA_ARGS__)
+#define LogErrorIf(cond, message, ...) LOG_IF_AT_LEVEL(LOG_ERROR, "[ERROR] ", cond, message, ##__VA_ARGS__)
+#define LogWarn(message, ...) LOG_AT_LEVEL(LOG_WARN, "[WARN]  ", message, ##__VA_ARGS__)
+#define LogWarnIf(cond, message, ...) LOG_IF_AT_LEVEL(LOG_WARN, "[WARN]  ", cond, message, ##__VA_ARGS__)
 #define LogInfo(message, ...)
+#define LogInfoIf(cond, message, ...)
 #define LogDebug(message, ...)
+#define LogDebugIf(cond, message, ...)
 
 #elif LOGGING_TOP_LOG_LEVEL == LOG_ERROR
-#define LogError(message, ...) LOG_WITH_FUNC("[ERROR] ", message, ##__VA_ARGS__)
+#define LogError(message, ...) LOG_AT_LEVEL(LOG_ERROR, "[ERROR] ", message, ##__VA_ARGS__)
+#define LogErrorIf(cond, message, ...) LOG_IF_AT_LEVEL(LOG_ERROR, "[ERROR] ", cond, message, ##__VA_ARGS__)
 #define LogWarn(message, ...)
+#define LogWarnIf(cond, message, ...)
 #define LogInfo(message, ...)
+#define LogInfoIf(cond, message, ...)
 #define LogDebug(message, ...)
+#define LogDebugIf(cond, message, ...)
 
 #else
 #define LogError(message, ...)
+#define LogErrorIf(cond, message, ...)
 #define LogWarn(message, ...)
+#define LogWarnIf(cond, message, ...)
 #define LogInfo(message, ...)
+#define LogInfoIf(cond, message, ...)
 #define LogDebug(message, ...)
+#define LogDebugIf(cond, message, ...)
 #endif
 
 #endif
@@ -0,0 +1,129 @@
+/**
+ * @file: logging_stats.h
+ * @author: Paweł Kawula (pawel.kawula@kelectronics.pl)
+ * @brief: Per-module, per-level emitted/dropped counters
+ * -----
+ * Copyright 2025 - KElectronics
+ * -----
+ * @note: Enabled with LOGGING_STATS. Every translation unit owns a counter
+ *        node (registered before main() like the runtime filter slots), so
+ *        counting is one relaxed atomic increment at the call site. Useful
+ *        for telemetry: the flooding module shows up in Logging_GetStats()
+ *        without counting output lines on the host.
+ */
+
+#ifndef LOGGING_STATS_H
+#define LOGGING_STATS_H
+
+#ifdef LOGGING_STATS
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "logging_levels.h"
+#include "logging_module.h"
+
+/* Counter slots per level, index is level - 1 (LOG_ERROR ... LOG_DEBUG) */
+#define LOGGING_STATS_LEVELS 4
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * @brief Counters of one translation unit, defined (static) by the per-file code below.
+ */
+typedef struct Logging_StatsNode
+{
+    const char *name;
+    uint16_t id;
+    uint32_t emitted[LOGGING_STATS_LEVELS];
+    uint32_t dropped[LOGGING_STATS_LEVELS];
+    struct Logging_StatsNode *next;
+} Logging_StatsNode_t;
+
+/**
+ * @brief Snapshot of the counters of one module.
+ */
+typedef struct
+{
+    const char *name;                       /**< LOGGING_LOG_NAME, "" for unnamed code */
+    uint16_t id;                            /**< LOGGING_MODULE_ID */
+    uint32_t emitted[LOGGING_STATS_LEVELS]; /**< Messages that passed the level filters */
+    uint32_t dropped[LOGGING_STATS_LEVELS]; /**< Of those, lost before reaching the output */
+} Logging_Stats_t;
+
+/**
+ * @brief Counters of code compiled without LOGGING_LOG_NAME.
+ */
+extern Logging_StatsNode_t logging_unnamed_stats;
+
+/**
+ * @brief Register a counter node, called by the per-file constructor.
+ *
+ * @param node Statically allocated node.
+ */
+void Logging_RegisterStats(Logging_StatsNode_t *node);
+
+/**
+ * @brief Take a snapshot of the counters of every module.
+ *
+ * Translation units sharing a LOGGING_LOG_NAME are merged into one entry.
+ * Counters are read one by one while logging goes on, so the snapshot is not
+ * atomic as a whole.
+ *
+ * @param stats Output array (may be NULL when max is 0).
+ * @param max   Number of entries the array holds.
+ * @return size_t Number of modules, may be larger than max (extra ones are not written).
+ *
+ * @example
+ * @code
+ * Logging_Stats_t stats[16];
+ * size_t count = Logging_GetStats(stats, 16);
+ * for (size_t i = 0; (i < count) && (i < 16); i++) {
+ *     telemetry_send(stats[i].id, stats[i].emitted[LOG_DEBUG - 1], stats[i].dropped[LOG_DEBUG - 1]);
+ * }
+ * @endcode
+ */
+size_t Logging_GetStats(Logging_Stats_t *stats, size_t max);
+
+/**
+ * @brief Clear the counters of every module.
+ */
+void Logging_ResetStats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#ifdef LOGGING_LOG_NAME
+/* Per translation unit counters, registered under LOGGING_LOG_NAME */
+static Logging_StatsNode_t logging_stats_ = { LOGGING_LOG_NAME, 0u, { 0 }, { 0 }, 0 };
+
+__attribute__((constructor)) static void logging_stats_register_(void)
+{
+    logging_stats_.id = LOGGING_MODULE_ID;
+    Logging_RegisterStats(&logging_stats_);
+}
+
+#define LOGGING_STATS_NODE logging_stats_
+#else
+#define LOGGING_STATS_NODE logging_unnamed_stats
+#endif
+
+#define LOGGING_STATS_EMITTED(level) \
+    ((void)__atomic_fetch_add(&LOGGING_STATS_NODE.emitted[(level) - 1], 1u, __ATOMIC_RELAXED))
+#define LOGGING_STATS_DROPPED(level) \
+    ((void)__atomic_fetch_add(&LOGGING_STATS_NODE.dropped[(level) - 1], 1u, __ATOMIC_RELAXED))
+
+#else
+
+#define LOGGING_STATS_EMITTED(level) ((void)0)
+#define LOGGING_STATS_DROPPED(level) ((void)0)
+
+#endif /* LOGGING_STATS */
+
+#define LOGGING_STATS_DROPPED_TAG(message) LOGGING_STATS_DROPPED(LOGGING_TAG_LEVEL(message))
+
+#endif /* LOGGING_STATS_H */
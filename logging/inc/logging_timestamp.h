@@ -0,0 +1,95 @@
+/**
+ * @file: logging_timestamp.h
+ * @author: Paweł Kawula (pawel.kawula@kelectronics.pl)
+ * @brief: Timestamps captured at the log site from a user-supplied fast clock
+ * -----
+ * Copyright 2025 - KElectronics
+ * -----
+ * @note: Enabled with LOGGING_TIMESTAMP. The log macros read the clock as
+ *        the first argument ("@<ticks> " after the level tag), so the value
+ *        reflects the call site even when formatting is deferred or queued.
+ *        Ticks stay a raw integer; conversion to time happens only when
+ *        formatting or decoding.
+ */
+
+#ifndef LOGGING_TIMESTAMP_H
+#define LOGGING_TIMESTAMP_H
+
+#ifdef LOGGING_TIMESTAMP
+
+#include <inttypes.h>
+#include <stdint.h>
+
+/**
+ * @brief Integer type of the raw timestamp.
+ *
+ * When changed, LOGGING_TIMESTAMP_FORMAT must be changed to match
+ * (e.g. uint64_t with PRIu64).
+ */
+#ifndef LOGGING_TIMESTAMP_TYPE
+#define LOGGING_TIMESTAMP_TYPE uint32_t
+#endif
+
+/**
+ * @brief printf conversion used for the raw timestamp.
+ */
+#ifndef LOGGING_TIMESTAMP_FORMAT
+#define LOGGING_TIMESTAMP_FORMAT "%" PRIu32
+#endif
+
+/**
+ * @brief Expression reading the clock at the log site.
+ *
+ * Should be a single register or variable read, e.g.:
+ *   - Cortex-M DWT: LOGGING_TIMESTAMP_SOURCE()=DWT->CYCCNT
+ *   - x86 hosts:    LOGGING_TIMESTAMP_SOURCE()=__rdtsc()
+ * Defaults to calling Logging_GetTimestamp(), provided by the application
+ * (e.g. wrapping clock_gettime()).
+ */
+#ifndef LOGGING_TIMESTAMP_SOURCE
+#define LOGGING_TIMESTAMP_SOURCE() Logging_GetTimestamp()
+#endif
+
+/**
+ * @brief Clock frequency used by Logging_TimestampToMicroseconds(), 0 when unknown.
+ */
+#ifndef LOGGING_TIMESTAMP_HZ
+#define LOGGING_TIMESTAMP_HZ 0
+#endif
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+typedef LOGGING_TIMESTAMP_TYPE Logging_Timestamp_t;
+
+/**
+ * @brief Default clock hook, implemented by the application when
+ *        LOGGING_TIMESTAMP_SOURCE() is not defined.
+ *
+ * @return Logging_Timestamp_t Current raw clock value.
+ */
+Logging_Timestamp_t Logging_GetTimestamp(void);
+
+/**
+ * @brief Convert raw ticks to microseconds using LOGGING_TIMESTAMP_HZ.
+ *
+ * For sinks and formatting tasks; the log site never converts.
+ *
+ * @param ticks Raw timestamp captured by the log macros.
+ * @return uint64_t Microseconds, or the raw ticks when LOGGING_TIMESTAMP_HZ is 0.
+ */
+uint64_t Logging_TimestampToMicroseconds(Logging_Timestamp_t ticks);
+
+#ifdef __cplusplus
+}
+#endif
+
+/* Literal slot and argument inserted by the log macros */
+#define LOG_TIMESTAMP_SLOT "@" LOGGING_TIMESTAMP_FORMAT " "
+#define LOG_TIMESTAMP_NOW() ((Logging_Timestamp_t)(LOGGING_TIMESTAMP_SOURCE()))
+
+#endif /* LOGGING_TIMESTAMP */
+
+#endif /* LOGGING_TIMESTAMP_H */
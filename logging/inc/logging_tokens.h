@@ -0,0 +1,241 @@
+/**
+ * @file: logging_tokens.h
+ * @author: Paweł Kawula (pawel.kawula@kelectronics.pl)
+ * @brief: Tokenized (dictionary) logging - send 32-bit string IDs instead of format literals
+ * -----
+ * Copyright 2025 - KElectronics
+ * -----
+ * @note: Enabled with LOGGING_TOKENIZED. Every log site hashes its
+ *        compile-time concatenated format literal into a 32-bit token. Only
+ *        the token and the encoded arguments are transmitted; the literal is
+ *        placed into the non-loaded .logging_tokens section, extracted from
+ *        the ELF by the logging_add_token_dictionary() CMake step and used by
+ *        tools/logging_tokens.py to decode the stream on the host.
+ */
+
+#ifndef LOGGING_TOKENS_H
+#define LOGGING_TOKENS_H
+
+#include <stdint.h>
+
+/**
+ * @brief Number of leading characters of the format literal covered by the hash.
+ *
+ * Fixed by the hash macro below; must match HASH_LENGTH in tools/logging_tokens.py.
+ */
+#define LOGGING_TOKEN_HASH_LENGTH 128
+
+/*
+ * 65599 polynomial hash over the first LOGGING_TOKEN_HASH_LENGTH characters,
+ * seeded with the literal length. Folded to a constant by the compiler
+ * (fully at -O1 and above), the literal itself is not emitted.
+ */
+#define LOGGING_TOKEN_CHAR(s, i) \
+    ((uint32_t)((i) < sizeof(s) - 1u ? (unsigned char)(s)[(i) < sizeof(s) ? (i) : 0] : 0u))
+
+#define LOGGING_TOKEN_HASH(s) \
+    ((uint32_t)(sizeof(s) - 1u) + \
+     LOGGING_TOKEN_CHAR(s, 0) * 0x0001003Fu + \
+     LOGGING_TOKEN_CHAR(s, 1) * 0x007E0F81u + \
+     LOGGING_TOKEN_CHAR(s, 2) * 0x2E86D0BFu + \
+     LOGGING_TOKEN_CHAR(s, 3) * 0x43EC5F01u + \
+     LOGGING_TOKEN_CHAR(s, 4) * 0x162C613Fu + \
+     LOGGING_TOKEN_CHAR(s, 5) * 0xD62AEE81u + \
+     LOGGING_TOKEN_CHAR(s, 6) * 0xA311B1BFu + \
+     LOGGING_TOKEN_CHAR(s, 7) * 0xD319BE01u + \
+     LOGGING_TOKEN_CHAR(s, 8) * 0xB156C23Fu + \
+     LOGGING_TOKEN_CHAR(s, 9) * 0x6698CD81u + \
+     LOGGING_TOKEN_CHAR(s, 10) * 0x0D1B92BFu + \
+     LOGGING_TOKEN_CHAR(s, 11) * 0xCC881D01u + \
+     LOGGING_TOKEN_CHAR(s, 12) * 0x7280233Fu + \
+     LOGGING_TOKEN_CHAR(s, 13) * 0x50C7AC81u + \
+     LOGGING_TOKEN_CHAR(s, 14) * 0x8DA473BFu + \
+     LOGGING_TOKEN_CHAR(s, 15) * 0x4F377C01u + \
+     LOGGING_TOKEN_CHAR(s, 16) * 0xFAA8843Fu + \
+     LOGGING_TOKEN_CHAR(s, 17) * 0x33B78B81u + \
+     LOGGING_TOKEN_CHAR(s, 18) * 0x45AC54BFu + \
+     LOGGING_TOKEN_CHAR(s, 19) * 0x7A27DB01u + \
+     LOGGING_TOKEN_CHAR(s, 20) * 0xEACFE53Fu + \
+     LOGGING_TOKEN_CHAR(s, 21) * 0xAE686A81u + \
+     LOGGING_TOKEN_CHAR(s, 22) * 0x563335BFu + \
+     LOGGING_TOKEN_CHAR(s, 23) * 0x6C593A01u + \
+     LOGGING_TOKEN_CHAR(s, 24) * 0xE3F6463Fu + \
+     LOGGING_TOKEN_CHAR(s, 25) * 0x5FDA4981u + \
+     LOGGING_TOKEN_CHAR(s, 26) * 0xE03916BFu + \
+     LOGGING_TOKEN_CHAR(s, 27) * 0x44CB9901u + \
+     LOGGING_TOKEN_CHAR(s, 28) * 0x871BA73Fu + \
+     LOGGING_TOKEN_CHAR(s, 29) * 0xE70D2881u + \
+     LOGGING_TOKEN_CHAR(s, 30) * 0x04BDF7BFu + \
+     LOGGING_TOKEN_CHAR(s, 31) * 0x227EF801u + \
+     LOGGING_TOKEN_CHAR(s, 32) * 0x7540083Fu + \
+     LOGGING_TOKEN_CHAR(s, 33) * 0xE3010781u + \
+     LOGGING_TOKEN_CHAR(s, 34) * 0xE4C1D8BFu + \
+     LOGGING_TOKEN_CHAR(s, 35) * 0x24735701u + \
+     LOGGING_TOKEN_CHAR(s, 36) * 0x4F63693Fu + \
+     LOGGING_TOKEN_CHAR(s, 37) * 0xF2B5E681u + \
+     LOGGING_TOKEN_CHAR(s, 38) * 0xA144B9BFu + \
+     LOGGING_TOKEN_CHAR(s, 39) * 0x69A8B601u + \
+     LOGGING_TOKEN_CHAR(s, 40) * 0xB685CA3Fu + \
+     LOGGING_TOKEN_CHAR(s, 41) * 0xB52BC581u + \
+     LOGGING_TOKEN_CHAR(s, 42) * 0x5B469ABFu + \
+     LOGGING_TOKEN_CHAR(s, 43) * 0x111F1501u + \
+     LOGGING_TOKEN_CHAR(s, 44) * 0x4BA72B3Fu + \
+     LOGGING_TOKEN_CHAR(s, 45) * 0xC962A481u + \
+     LOGGING_TOKEN_CHAR(s, 46) * 0x33C77BBFu + \
+     LOGGING_TOKEN_CHAR(s, 47) * 0x39D67401u + \
+     LOGGING_TOKEN_CHAR(s, 48) * 0xAFC78C3Fu + \
+     LOGGING_TOKEN_CHAR(s, 49) * 0xCE5A8381u + \
+     LOGGING_TOKEN_CHAR(s, 50) * 0x4BC75CBFu + \
+     LOGGING_TOKEN_CHAR(s, 51) * 0x02CED301u + \
+     LOGGING_TOKEN_CHAR(s, 52) * 0x83E6ED3Fu + \
+     LOGGING_TOKEN_CHAR(s, 53) * 0x63136281u + \
+     LOGGING_TOKEN_CHAR(s, 54) * 0xC4463DBFu + \
+     LOGGING_TOKEN_CHAR(s, 55) * 0x8B083201u + \
+     LOGGING_TOKEN_CHAR(s, 56) * 0x69054E3Fu + \
+     LOGGING_TOKEN_CHAR(s, 57) * 0x268D4181u + \
+     LOGGING_TOKEN_CHAR(s, 58) * 0xBE441EBFu + \
+     LOGGING_TOKEN_CHAR(s, 59) * 0xF1829101u + \
+     LOGGING_TOKEN_CHAR(s, 60) * 0x0022AF3Fu + \
+     LOGGING_TOKEN_CHAR(s, 61) * 0xB7C82081u + \
+     LOGGING_TOKEN_CHAR(s, 62) * 0x5AC0FFBFu + \
+     LOGGING_TOKEN_CHAR(s, 63) * 0x553DF001u + \
+     LOGGING_TOKEN_CHAR(s, 64) * 0xEA3F103Fu + \
+     LOGGING_TOKEN_CHAR(s, 65) * 0xB5C3FF81u + \
+     LOGGING_TOKEN_CHAR(s, 66) * 0xBABCE0BFu + \
+     LOGGING_TOKEN_CHAR(s, 67) * 0xD53A4F01u + \
+     LOGGING_TOKEN_CHAR(s, 68) * 0xC85A713Fu + \
+     LOGGING_TOKEN_CHAR(s, 69) * 0xBF80DE81u + \
+     LOGGING_TOKEN_CHAR(s, 70) * 0xFF37C1BFu + \
+     LOGGING_TOKEN_CHAR(s, 71) * 0x9077AE01u + \
+     LOGGING_TOKEN_CHAR(s, 72) * 0x3B74D23Fu + \
+     LOGGING_TOKEN_CHAR(s, 73) * 0x73FEBD81u + \
+     LOGGING_TOKEN_CHAR(s, 74) * 0x4931A2BFu + \
+     LOGGING_TOKEN_CHAR(s, 75) * 0xA5F60D01u + \
+     LOGGING_TOKEN_CHAR(s, 76) * 0xE48E333Fu + \
+     LOGGING_TOKEN_CHAR(s, 77) * 0x723D9C81u + \
+     LOGGING_TOKEN_CHAR(s, 78) * 0xB9AA83BFu + \
+     LOGGING_TOKEN_CHAR(s, 79) * 0x34B56C01u + \
+     LOGGING_TOKEN_CHAR(s, 80) * 0x64A6943Fu + \
+     LOGGING_TOKEN_CHAR(s, 81) * 0x593D7B81u + \
+     LOGGING_TOKEN_CHAR(s, 82) * 0x71A264BFu + \
+     LOGGING_TOKEN_CHAR(s, 83) * 0x5BB5CB01u + \
+     LOGGING_TOKEN_CHAR(s, 84) * 0x5CBDF53Fu + \
+     LOGGING_TOKEN_CHAR(s, 85) * 0xC7FE5A81u + \
+     LOGGING_TOKEN_CHAR(s, 86) * 0x921945BFu + \
+     LOGGING_TOKEN_CHAR(s, 87) * 0x39F72A01u + \
+     LOGGING_TOKEN_CHAR(s, 88) * 0x6DD4563Fu + \
+     LOGGING_TOKEN_CHAR(s, 89) * 0x5D803981u + \
+     LOGGING_TOKEN_CHAR(s, 90) * 0x3C0F26BFu + \
+     LOGGING_TOKEN_CHAR(s, 91) * 0xEE798901u + \
+     LOGGING_TOKEN_CHAR(s, 92) * 0x38E9B73Fu + \
+     LOGGING_TOKEN_CHAR(s, 93) * 0xB8C31881u + \
+     LOGGING_TOKEN_CHAR(s, 94) * 0x908407BFu + \
+     LOGGING_TOKEN_CHAR(s, 95) * 0x983CE801u + \
+     LOGGING_TOKEN_CHAR(s, 96) * 0x5EFE183Fu + \
+     LOGGING_TOKEN_CHAR(s, 97) * 0x78C6F781u + \
+     LOGGING_TOKEN_CHAR(s, 98) * 0xB077E8BFu + \
+     LOGGING_TOKEN_CHAR(s, 99) * 0x56414701u + \
+     LOGGING_TOKEN_CHAR(s, 100) * 0x8111793Fu + \
+     LOGGING_TOKEN_CHAR(s, 101) * 0x3C8BD681u + \
+     LOGGING_TOKEN_CHAR(s, 102) * 0xBCEAC9BFu + \
+     LOGGING_TOKEN_CHAR(s, 103) * 0x4786A601u + \
+     LOGGING_TOKEN_CHAR(s, 104) * 0x4023DA3Fu + \
+     LOGGING_TOKEN_CHAR(s, 105) * 0xA311B581u + \
+     LOGGING_TOKEN_CHAR(s, 106) * 0xD6DCAABFu + \
+     LOGGING_TOKEN_CHAR(s, 107) * 0x8B0D0501u + \
+     LOGGING_TOKEN_CHAR(s, 108) * 0x3D353B3Fu + \
+     LOGGING_TOKEN_CHAR(s, 109) * 0x4B589481u + \
+     LOGGING_TOKEN_CHAR(s, 110) * 0x1F4D8BBFu + \
+     LOGGING_TOKEN_CHAR(s, 111) * 0x3FD46401u + \
+     LOGGING_TOKEN_CHAR(s, 112) * 0x19459C3Fu + \
+     LOGGING_TOKEN_CHAR(s, 113) * 0xD4607381u + \
+     LOGGING_TOKEN_CHAR(s, 114) * 0xB73D6CBFu + \
+     LOGGING_TOKEN_CHAR(s, 115) * 0x84DCC301u + \
+     LOGGING_TOKEN_CHAR(s, 116) * 0x7554FD3Fu + \
+     LOGGING_TOKEN_CHAR(s, 117) * 0xDD295281u + \
+     LOGGING_TOKEN_CHAR(s, 118) * 0xBFAC4DBFu + \
+     LOGGING_TOKEN_CHAR(s, 119) * 0x79262201u + \
+     LOGGING_TOKEN_CHAR(s, 120) * 0xF2635E3Fu + \
+     LOGGING_TOKEN_CHAR(s, 121) * 0x04B33181u + \
+     LOGGING_TOKEN_CHAR(s, 122) * 0x599A2EBFu + \
+     LOGGING_TOKEN_CHAR(s, 123) * 0x3BB08101u + \
+     LOGGING_TOKEN_CHAR(s, 124) * 0x3170BF3Fu + \
+     LOGGING_TOKEN_CHAR(s, 125) * 0xE9FE1081u + \
+     LOGGING_TOKEN_CHAR(s, 126) * 0xA6070FBFu + \
+     LOGGING_TOKEN_CHAR(s, 127) * 0xEB7BE001u)
+
+/* Entry placed in the dictionary section, never referenced by code (also used by LOGGING_TRACE) */
+#define LOGGING_TOKEN_SECTION __attribute__((section(".logging_tokens"), used))
+
+#ifdef LOGGING_TOKENIZED
+
+#include <stddef.h>
+
+#ifdef LOGGING_DEFERRED
+#error "LOGGING_TOKENIZED and LOGGING_DEFERRED are mutually exclusive."
+#endif
+
+/**
+ * @brief Size of the frame buffer used to encode one message.
+ *
+ * Longer messages are truncated (string arguments are cut first).
+ */
+#ifndef LOGGING_TOKEN_BUFFER_SIZE
+#define LOGGING_TOKEN_BUFFER_SIZE 64
+#endif
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * @brief Initialize tokenized logging with a byte output function.
+ *
+ * Every log call produces one self-delimiting frame:
+ * varint(length) | token (4 bytes, little endian) | encoded arguments.
+ * Integers are zigzag varints, doubles are sent as IEEE float32, strings as
+ * varint(length) followed by the characters.
+ *
+ * @param write_func Function receiving complete frames, NULL disables output.
+ *
+ * @example
+ * @code
+ * static int uart_write(const uint8_t *data, size_t length) {
+ *     return uart_send(data, length);
+ * }
+ *
+ * int main(void) {
+ *     Logging_InitTokenized(uart_write);
+ *     LogInfo("Boot reason %d", reason);   // Sends ~7 bytes instead of ~40
+ * }
+ * @endcode
+ */
+void Logging_InitTokenized(Logging_WriteFunction_t write_func);
+
+/**
+ * @brief Encode and emit one tokenized message, used by the log macros.
+ *
+ * @param token Hash of the format literal.
+ * @param types Argument descriptor built by LOGGING_ARG_TYPES().
+ * @param ...   Arguments described by types.
+ */
+void Logging_TokenLog(uint32_t token, uint32_t types, ...);
+
+#ifdef __cplusplus
+}
+#endif
+
+/* Call site: token + argument descriptor, the literal only goes to the dictionary */
+#define LOGGING_TOKENIZE(message, ...)                                                  \
+    do                                                                                  \
+    {                                                                                   \
+        LOGGING_CHECK_FORMAT(message, ##__VA_ARGS__);                                   \
+        static const char logging_token_entry_[] LOGGING_TOKEN_SECTION = message;       \
+        Logging_TokenLog(LOGGING_TOKEN_HASH(message), LOGGING_ARG_TYPES(__VA_ARGS__),   \
+                         ##__VA_ARGS__);                                                \
+    } while (0)
+
+#endif /* LOGGING_TOKENIZED */
+
+#endif /* LOGGING_TOKENS_H */
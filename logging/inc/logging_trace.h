@@ -0,0 +1,144 @@
+/**
+ * @file: logging_trace.h
+ * @author: Paweł Kawula (pawel.kawula@kelectronics.pl)
+ * @brief: Scope tracing - begin/end timestamps as compact binary events
+ * -----
+ * Copyright 2025 - KElectronics
+ * -----
+ * @note: Enabled with LOGGING_TRACE. LogTraceScope("name") emits a begin
+ *        event where it is declared and the matching end event when the
+ *        enclosing block is left (GCC/Clang cleanup attribute in C, RAII in
+ *        logging.hpp). Events are stamped with the LOGGING_TIMESTAMP clock
+ *        and handed to the function registered with Logging_InitTrace(),
+ *        e.g. one of the buffered byte outputs. Scope names are hashed like
+ *        tokenized format literals: only the 32-bit token travels, the name
+ *        goes to the .logging_tokens dictionary section and tools/logging_tokens.py
+ *        converts the stream to Chrome trace / Perfetto JSON.
+ *
+ * Event layout (multi-byte values little endian):
+ * @code
+ * u8  length           bytes following this field
+ * u8  phase            LOGGING_TRACE_BEGIN ('B') / LOGGING_TRACE_END ('E')
+ * u8  track            LOGGING_TRACE_TRACK() of the emitting context
+ * u32 name             LOGGING_TOKEN_HASH() of the scope name
+ * timestamp            sizeof(Logging_Timestamp_t) bytes
+ * @endcode
+ */
+
+#ifndef LOGGING_TRACE_H
+#define LOGGING_TRACE_H
+
+#include <stdint.h>
+
+/* Wire format - shared with the host tool, independent of LOGGING_TRACE */
+#define LOGGING_TRACE_BEGIN ((uint8_t)'B')
+#define LOGGING_TRACE_END ((uint8_t)'E')
+
+#ifdef LOGGING_TRACE
+
+#include "logging_stack.h"
+
+#ifndef LOGGING_TIMESTAMP
+#error "LOGGING_TRACE stamps events with the call site clock, define LOGGING_TIMESTAMP."
+#define LogTraceScope(name) /* Keeps the #error the only diagnostic */
+#else
+
+/**
+ * @brief Track (Chrome trace "tid") of the calling context, 0..255.
+ *
+ * E.g. the core index, or a task number so nested scopes of different
+ * tasks end up on separate rows. Evaluated once per event.
+ */
+#ifndef LOGGING_TRACE_TRACK
+#define LOGGING_TRACE_TRACK() 0
+#endif
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * @brief Initialize scope tracing with a byte output function.
+ *
+ * Independent of the text output, so events can go to their own channel or
+ * buffer (Logging_PosixWrite, Logging_MmapWrite, a RAM ring...).
+ *
+ * @param write_func Function receiving complete events, NULL disables tracing.
+ *
+ * @example
+ * @code
+ * Logging_InitTrace(trace_write);
+ *
+ * void control_loop(void) {
+ *     LogTraceScope("control_loop");
+ *     read_sensors();
+ *     {
+ *         LogTraceScope("pid");
+ *         update_pid();
+ *     }                            // "pid" ends here
+ * }                                // "control_loop" ends here
+ * @endcode
+ */
+void Logging_InitTrace(Logging_WriteFunction_t write_func);
+
+/**
+ * @brief Encode and emit one event, used by the trace macros.
+ *
+ * @param phase     LOGGING_TRACE_BEGIN or LOGGING_TRACE_END.
+ * @param name      Token of the scope name.
+ * @param timestamp Clock value captured at the call site.
+ */
+void Logging_TraceEvent(uint8_t phase, uint32_t name, Logging_Timestamp_t timestamp);
+
+/**
+ * @brief State of an open scope, ended by Logging_TraceScopeEnd().
+ */
+typedef struct
+{
+    uint32_t name;
+} Logging_TraceScope_t;
+
+static inline Logging_TraceScope_t Logging_TraceScopeBegin(uint32_t name)
+{
+    Logging_TraceScope_t scope;
+    scope.name = name;
+    Logging_TraceEvent(LOGGING_TRACE_BEGIN, name, LOG_TIMESTAMP_NOW());
+    return scope;
+}
+
+/* Cleanup handler, runs when the scope variable goes out of scope */
+static inline void Logging_TraceScopeEnd(const Logging_TraceScope_t *scope)
+{
+    Logging_TraceEvent(LOGGING_TRACE_END, scope->name, LOG_TIMESTAMP_NOW());
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#if defined(LOGGING_DISABLED_GLOBALLY)
+#define LogTraceScope(name)
+#else
+#define LOGGING_TRACE_SCOPE(name, id)                                                             \
+    static const char LOGGING_CONCAT(id, _name)[] LOGGING_TOKEN_SECTION = name;                   \
+    const Logging_TraceScope_t id __attribute__((cleanup(Logging_TraceScopeEnd), unused)) =       \
+        Logging_TraceScopeBegin(LOGGING_TOKEN_HASH(name))
+
+/**
+ * @brief Trace the rest of the enclosing block under a string literal name.
+ *
+ * A declaration: place it where declarations may appear, at most once per line.
+ */
+#define LogTraceScope(name) LOGGING_TRACE_SCOPE(name, LOGGING_CONCAT(logging_trace_scope_, __LINE__))
+#endif
+
+#endif /* LOGGING_TIMESTAMP */
+
+#else
+
+#define LogTraceScope(name)
+
+#endif /* LOGGING_TRACE */
+
+#endif /* LOGGING_TRACE_H */
@@ -0,0 +1,70 @@
+/**
+ * @file: logging_types.h
+ * @author: Paweł Kawula (pawel.kawula@kelectronics.pl)
+ * @brief: Output function types accepted by the logging system
+ * -----
+ * Copyright 2025 - KElectronics
+ * -----
+ */
+
+#ifndef LOGGING_TYPES_H
+#define LOGGING_TYPES_H
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * @brief printf-style logging function, receives the format string and arguments.
+ */
+typedef int (*Logging_Function_t)(const char *message, ...);
+
+/**
+ * @brief va_list logging function, receives the format string and the argument list.
+ *
+ * Arguments are forwarded without another variadic hop, so such functions can
+ * be chained (timestamps, filters, buffering) by passing the list on - use
+ * va_copy() when the list is consumed more than once.
+ */
+typedef int (*Logging_VFunction_t)(const char *message, va_list args);
+
+/**
+ * @brief Raw byte output function, receives already encoded data.
+ *
+ * @param data   Bytes to transmit.
+ * @param length Number of bytes.
+ * @return int Implementation defined, ignored by the library.
+ */
+typedef int (*Logging_WriteFunction_t)(const uint8_t *data, size_t length);
+
+/**
+ * @brief One record of a batch: bytes and their count.
+ */
+typedef struct
+{
+    const uint8_t *data;
+    size_t length;
+} Logging_Span_t;
+
+/**
+ * @brief Batch output function, receives several complete records in one call.
+ *
+ * The records lie back to back in one buffer, so the batch can also be sent
+ * as a single span from records[0].data, see Logging_BatchLength().
+ *
+ * @param records Records in logging order.
+ * @param count   Number of records, at least 1.
+ * @return int Implementation defined, ignored by the library.
+ */
+typedef int (*Logging_BatchFunction_t)(const Logging_Span_t *records, size_t count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LOGGING_TYPES_H */
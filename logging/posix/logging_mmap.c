@@ -0,0 +1,188 @@
+/**
+ * @file: logging_mmap.c
+ * @author:: Paweł Kawula (pawel.kawula@kelectronics.pl)
+ * -----
+ * Copyright 2025 - KElectronics
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "logging_mmap.h"
+#include "logging_atomic.h"
+
+/* Part of the file format */
+LOGGING_STATIC_ASSERT(sizeof(Logging_MmapHeader_t) == 64u, logging_mmap_header_is_64_bytes_);
+
+/* Published last by Logging_MmapOpen(), NULL while closed */
+static Logging_MmapHeader_t *mmap_header = NULL;
+static uint8_t *mmap_data = NULL;
+static uint64_t mmap_capacity = 0u;
+static int mmap_fd = -1;
+
+static uint32_t *mmap_length_word(uint64_t offset)
+{
+    return (uint32_t *)(void *)&mmap_data[offset];
+}
+
+/*
+ * Move the committed offset over every published record that follows it.
+ * Called by each producer after publishing: whoever completes the record at
+ * the committed offset carries it forward, nobody waits for a slower one.
+ */
+static void mmap_advance(Logging_MmapHeader_t *header)
+{
+    uint64_t committed = LOGGING_ATOMIC_LOAD_ACQUIRE(&header->committed);
+
+    while ((committed + 4u) <= mmap_capacity)
+    {
+        uint32_t word = LOGGING_ATOMIC_LOAD_ACQUIRE(mmap_length_word(committed));
+        uint64_t next;
+
+        if ((word & LOGGING_MMAP_COMMITTED) == 0u)
+        {
+            return; /* Still being written, its producer continues from here */
+        }
+
+        next = committed + LOGGING_MMAP_RECORD_SPACE(word & ~LOGGING_MMAP_COMMITTED);
+        if (LOGGING_ATOMIC_CAS_WEAK(&header->committed, &committed, next))
+        {
+            /* Pairs with the fence after publishing: one of the two producers sees the other */
+            LOGGING_ATOMIC_FENCE_SEQ_CST();
+            committed = next;
+        }
+    }
+}
+
+int Logging_MmapOpen(const char *path, size_t size)
+{
+    Logging_MmapHeader_t *header;
+    struct stat status;
+    void *base;
+    int fd;
+
+    if ((path == NULL) || (size < (sizeof(Logging_MmapHeader_t) + 64u)))
+    {
+        errno = EINVAL;
+        return -1;
+    }
+    if (LOGGING_ATOMIC_LOAD_ACQUIRE(&mmap_header) != NULL)
+    {
+        errno = EBUSY;
+        return -1;
+    }
+
+    fd = open(path, O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (fd < 0)
+    {
+        return -1;
+    }
+    if ((fstat(fd, &status) != 0) || (((size_t)status.st_size != size) && (ftruncate(fd, (off_t)size) != 0)))
+    {
+        (void)close(fd);
+        return -1;
+    }
+
+    base = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (base == MAP_FAILED)
+    {
+        (void)close(fd);
+        return -1;
+    }
+
+    header = (Logging_MmapHeader_t *)base;
+    mmap_data = (uint8_t *)base + sizeof(Logging_MmapHeader_t);
+    mmap_capacity = (uint64_t)(size - sizeof(Logging_MmapHeader_t));
+    mmap_fd = fd;
+
+    if ((header->magic == LOGGING_MMAP_MAGIC) && (header->version == LOGGING_MMAP_VERSION) &&
+        (header->size == (uint64_t)size) && (header->committed <= mmap_capacity))
+    {
+        /* Continue after the last complete record, forget reservations that never completed */
+        uint64_t end = (header->reserved < mmap_capacity) ? header->reserved : mmap_capacity;
+
+        if (end > header->committed)
+        {
+            memset(&mmap_data[header->committed], 0, (size_t)(end - header->committed));
+        }
+        header->reserved = header->committed;
+    }
+    else
+    {
+        memset(base, 0, size);
+        header->magic = LOGGING_MMAP_MAGIC;
+        header->version = LOGGING_MMAP_VERSION;
+        header->size = (uint64_t)size;
+    }
+
+    LOGGING_ATOMIC_STORE_RELEASE(&mmap_header, header);
+    return 0;
+}
+
+int Logging_MmapWrite(const uint8_t *data, size_t length)
+{
+    Logging_MmapHeader_t *header = LOGGING_ATOMIC_LOAD_ACQUIRE(&mmap_header);
+    uint64_t space = LOGGING_MMAP_RECORD_SPACE(length);
+    uint64_t offset;
+
+    if ((header == NULL) || (length >= LOGGING_MMAP_COMMITTED))
+    {
+        return 0;
+    }
+
+    offset = LOGGING_ATOMIC_FETCH_ADD_RELAXED(&header->reserved, space);
+    if ((offset + space) > mmap_capacity)
+    {
+        LOGGING_ATOMIC_FETCH_ADD_RELAXED(&header->dropped, 1u);
+        return 0;
+    }
+
+    memcpy(&mmap_data[offset + 4u], data, length);
+    LOGGING_ATOMIC_STORE_RELEASE(mmap_length_word(offset), LOGGING_MMAP_COMMITTED | (uint32_t)length);
+
+    /* Publishing store before the committed offset load, see mmap_advance() */
+    LOGGING_ATOMIC_FENCE_SEQ_CST();
+    mmap_advance(header);
+
+    return (int)length;
+}
+
+int Logging_MmapSync(void)
+{
+    Logging_MmapHeader_t *header = LOGGING_ATOMIC_LOAD_ACQUIRE(&mmap_header);
+
+    if (header == NULL)
+    {
+        return -1;
+    }
+    return msync(header, (size_t)header->size, MS_SYNC);
+}
+
+void Logging_MmapClose(void)
+{
+    Logging_MmapHeader_t *header = LOGGING_ATOMIC_EXCHANGE_ACQUIRE(&mmap_header, NULL);
+
+    if (header == NULL)
+    {
+        return;
+    }
+
+    (void)munmap(header, (size_t)header->size);
+    (void)close(mmap_fd);
+    mmap_fd = -1;
+    mmap_data = NULL;
+    mmap_capacity = 0u;
+}
+
+uint32_t Logging_GetMmapDropped(void)
+{
+    Logging_MmapHeader_t *header = LOGGING_ATOMIC_LOAD_ACQUIRE(&mmap_header);
+
+    return (header != NULL) ? LOGGING_ATOMIC_LOAD_RELAXED(&header->dropped) : 0u;
+}
@@ -0,0 +1,111 @@
+/**
+ * @file: logging_mmap.h
+ * @author: Paweł Kawula (pawel.kawula@kelectronics.pl)
+ * @brief: Memory-mapped log file output - lock-free append, no syscalls per message
+ * -----
+ * Copyright 2025 - KElectronics
+ * -----
+ * @note: Part of the logging_posix library. The file is sized once and
+ *        mapped shared; Logging_MmapWrite() (a Logging_WriteFunction_t)
+ *        reserves space with one atomic fetch-add on the header, copies the
+ *        record and publishes it by writing its length word. Another process
+ *        can map the same file and follow the committed offset live, see
+ *        logging_mmap_tail. When the file is full records are dropped and
+ *        counted in the header.
+ *
+ *        File layout (host byte order):
+ *        Logging_MmapHeader_t (64 bytes) | records
+ *        record = u32 (LOGGING_MMAP_COMMITTED | length) | length bytes | 0..3 bytes padding
+ *        A zero length word marks a record still being written.
+ */
+
+#ifndef LOGGING_MMAP_H
+#define LOGGING_MMAP_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "logging.h"
+
+#define LOGGING_MMAP_MAGIC 0x4D4D474Cu /* "LGMM" */
+#define LOGGING_MMAP_VERSION 1u
+
+/* Set in the length word of every published record */
+#define LOGGING_MMAP_COMMITTED 0x80000000u
+
+/* Space taken by a record of length bytes in the data area */
+#define LOGGING_MMAP_RECORD_SPACE(length) ((((uint64_t)(length)) + 4u + 3u) & ~(uint64_t)3u)
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * @brief Header at the start of the mapped file, shared with readers.
+ */
+typedef struct
+{
+    uint32_t magic;       /**< LOGGING_MMAP_MAGIC */
+    uint32_t version;     /**< LOGGING_MMAP_VERSION */
+    uint64_t size;        /**< File size in bytes (header included) */
+    uint64_t reserved;    /**< Data offset handed to the next producer, may pass the capacity */
+    uint64_t committed;   /**< Every record below this data offset is complete */
+    uint32_t dropped;     /**< Records that did not fit */
+    uint32_t padding[7];
+} Logging_MmapHeader_t;
+
+/**
+ * @brief Create or reopen the log file and map it.
+ *
+ * A file with a valid header and the same size is continued after its last
+ * complete record, anything else is recreated empty.
+ *
+ * @param path File to map.
+ * @param size File size in bytes (header included), fixed while mapped.
+ * @return int 0 on success, -1 on error (already open, size too small, open()/ftruncate()/mmap() failed; errno is set).
+ *
+ * @example
+ * @code
+ * Logging_MmapOpen("/run/gateway.log", 16u * 1024u * 1024u);
+ * Logging_InitWrite(Logging_MmapWrite);   // or Logging_AddSink(Logging_MmapWrite, mask)
+ * LogInfo("Gateway started");              // memcpy into the page cache
+ * @endcode
+ */
+int Logging_MmapOpen(const char *path, size_t size);
+
+/**
+ * @brief Append one record, callable from any thread.
+ *
+ * @param data   Record bytes.
+ * @param length Number of bytes.
+ * @return int Number of bytes written, 0 when dropped (file full or not open).
+ */
+int Logging_MmapWrite(const uint8_t *data, size_t length);
+
+/**
+ * @brief Write the mapped pages back to the storage device (msync), blocks the caller.
+ *
+ * @return int 0 on success, -1 on error or when the file is not open.
+ */
+int Logging_MmapSync(void);
+
+/**
+ * @brief Unmap and close the file.
+ *
+ * @note Call after the last log message, producers must not run concurrently.
+ */
+void Logging_MmapClose(void);
+
+/**
+ * @brief Get the number of records dropped because the file was full.
+ *
+ * @return uint32_t Dropped record counter (kept in the file header), 0 when not open.
+ */
+uint32_t Logging_GetMmapDropped(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LOGGING_MMAP_H */
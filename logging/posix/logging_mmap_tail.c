@@ -0,0 +1,112 @@
+/**
+ * @file: logging_mmap_tail.c
+ * @author:: Paweł Kawula (pawel.kawula@kelectronics.pl)
+ * -----
+ * Copyright 2025 - KElectronics
+ * -----
+ * @note: Prints the records of a Logging_MmapOpen() file to stdout, raw
+ *        (text lines as they are, binary frames can be piped to a decoder).
+ *        Usage: logging_mmap_tail [-f] file
+ *        With -f keeps following the committed offset while the producer runs.
+ */
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "logging_mmap.h"
+
+#define FOLLOW_INTERVAL_MS 100
+
+int main(int argc, char **argv)
+{
+    const Logging_MmapHeader_t *header;
+    const uint8_t *data;
+    uint64_t capacity;
+    uint64_t offset = 0u;
+    struct stat status;
+    int follow = 0;
+    int fd;
+    void *base;
+
+    if ((argc == 3) && (strcmp(argv[1], "-f") == 0))
+    {
+        follow = 1;
+    }
+    else if (argc != 2)
+    {
+        fprintf(stderr, "usage: %s [-f] file\n", argv[0]);
+        return 2;
+    }
+
+    fd = open(argv[argc - 1], O_RDONLY);
+    if ((fd < 0) || (fstat(fd, &status) != 0) || ((size_t)status.st_size < sizeof(Logging_MmapHeader_t)))
+    {
+        perror(argv[argc - 1]);
+        return 2;
+    }
+    base = mmap(NULL, (size_t)status.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    if (base == MAP_FAILED)
+    {
+        perror("mmap");
+        return 2;
+    }
+
+    header = (const Logging_MmapHeader_t *)base;
+    if ((header->magic != LOGGING_MMAP_MAGIC) || (header->version != LOGGING_MMAP_VERSION) ||
+        (header->size != (uint64_t)status.st_size))
+    {
+        fprintf(stderr, "%s: not a logging mmap file\n", argv[argc - 1]);
+        return 2;
+    }
+    data = (const uint8_t *)base + sizeof(Logging_MmapHeader_t);
+    capacity = header->size - sizeof(Logging_MmapHeader_t);
+
+    for (;;)
+    {
+        /* Records below the committed offset are complete and never change */
+        uint64_t committed = __atomic_load_n(&header->committed, __ATOMIC_ACQUIRE);
+
+        if (committed > capacity)
+        {
+            fprintf(stderr, "corrupted header\n");
+            return 1;
+        }
+
+        while (offset < committed)
+        {
+            uint32_t word;
+            uint32_t length;
+
+            memcpy(&word, &data[offset], sizeof(word));
+            length = word & ~LOGGING_MMAP_COMMITTED;
+            if (((word & LOGGING_MMAP_COMMITTED) == 0u) || ((offset + LOGGING_MMAP_RECORD_SPACE(length)) > committed))
+            {
+                fprintf(stderr, "corrupted record at offset %llu\n", (unsigned long long)offset);
+                return 1;
+            }
+            fwrite(&data[offset + 4u], 1u, length, stdout);
+            offset += LOGGING_MMAP_RECORD_SPACE(length);
+        }
+        fflush(stdout);
+
+        if (!follow)
+        {
+            break;
+        }
+
+        struct timespec interval = { 0, FOLLOW_INTERVAL_MS * 1000000L };
+        nanosleep(&interval, NULL);
+    }
+
+    if (header->dropped > 0u)
+    {
+        fprintf(stderr, "%u records dropped, file full\n", (unsigned)header->dropped);
+    }
+
+    return 0;
+}
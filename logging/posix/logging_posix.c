@@ -0,0 +1,495 @@
+/**
+ * @file: logging_posix.c
+ * @author:: Paweł Kawula (pawel.kawula@kelectronics.pl)
+ * -----
+ * Copyright 2025 - KElectronics
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <pthread.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "logging_posix.h"
+#include "logging_atomic.h"
+
+#if (LOGGING_POSIX_QUEUE_LEN < 2) || ((LOGGING_POSIX_QUEUE_LEN & (LOGGING_POSIX_QUEUE_LEN - 1)) != 0)
+#error "LOGGING_POSIX_QUEUE_LEN must be a power of two."
+#endif
+
+#if (LOGGING_POSIX_RECORD_SIZE < 4) || (LOGGING_POSIX_RECORD_SIZE > 65535)
+#error "LOGGING_POSIX_RECORD_SIZE must be in range 4..65535."
+#endif
+
+#if (LOGGING_POSIX_BATCH < 1) || (defined(IOV_MAX) && (LOGGING_POSIX_BATCH > IOV_MAX))
+#error "LOGGING_POSIX_BATCH must be in range 1..IOV_MAX."
+#endif
+
+#define POSIX_QUEUE_MASK ((size_t)LOGGING_POSIX_QUEUE_LEN - 1u)
+
+#define POSIX_OPEN_FLAGS (O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC)
+
+/*
+ * Same multi-producer ring as LOGGING_DEFERRED_MPSC, holding bytes instead
+ * of argument words. The sequence is stored relative to the slot index so
+ * that the zero-initialized ring is valid:
+ *     actual sequence = slot.sequence + index
+ */
+typedef struct
+{
+    size_t sequence;
+    uint16_t length;
+    uint8_t data[LOGGING_POSIX_RECORD_SIZE];
+} Posix_Slot_t;
+
+static Posix_Slot_t posix_queue[LOGGING_POSIX_QUEUE_LEN];
+static size_t posix_head = 0;                             /* Next position to be reserved */
+static size_t posix_tail __attribute__((aligned(64))) = 0; /* Next position to be written, writer owned */
+static uint32_t posix_dropped = 0;
+static int posix_running = 0;                             /* Records accepted, writer thread alive */
+static uint32_t posix_sync_requests = 0;                  /* Bumped by Logging_PosixFlush() */
+static uint32_t posix_sync_done = 0;                      /* Last request served by the writer */
+static uint8_t posix_panic = 0;                           /* Set by Logging_PosixPanicWrite(), the writer thread stops */
+static uint8_t posix_panic_busy = 0;                      /* Held while a panic write drains the ring */
+static uint8_t posix_writer_busy = 0;                     /* Held by the writer thread while it uses the file */
+
+/* Writer thread state, set up by Logging_PosixOpen() before the thread starts */
+static pthread_t posix_thread;
+static Logging_PosixConfig_t posix_config;
+static int posix_fd = -1;
+static size_t posix_file_size = 0;
+
+static uint64_t posix_now_ms(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((uint64_t)now.tv_sec * 1000u) + ((uint64_t)now.tv_nsec / 1000000u);
+}
+
+static void posix_idle(void)
+{
+    struct timespec idle = { 0, (long)LOGGING_POSIX_IDLE_US * 1000L };
+    nanosleep(&idle, NULL);
+}
+
+static Posix_Slot_t *posix_peek(size_t position)
+{
+    size_t index = position & POSIX_QUEUE_MASK;
+    Posix_Slot_t *slot = &posix_queue[index];
+
+    if ((LOGGING_ATOMIC_LOAD_ACQUIRE(&slot->sequence) + index) != (position + 1u))
+    {
+        return NULL; /* Empty or reserved but not yet committed */
+    }
+    return slot;
+}
+
+static void posix_release(size_t position, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        size_t index = (position + i) & POSIX_QUEUE_MASK;
+        LOGGING_ATOMIC_STORE_RELEASE(&posix_queue[index].sequence,
+                                     position + i + LOGGING_POSIX_QUEUE_LEN - index);
+    }
+    LOGGING_ATOMIC_STORE_RELEASE(&posix_tail, position + count);
+}
+
+/* Text lines start with the level tag, see LogError() */
+static int posix_is_error(const Posix_Slot_t *slot)
+{
+    return (slot->length >= 2u) && (slot->data[0] == '[') && (slot->data[1] == 'E');
+}
+
+static int posix_open_file(int truncate)
+{
+    int fd = open(posix_config.path, POSIX_OPEN_FLAGS | (truncate ? O_TRUNC : 0), 0644);
+    struct stat status;
+
+    posix_file_size = 0;
+    if ((fd >= 0) && (fstat(fd, &status) == 0))
+    {
+        posix_file_size = (size_t)status.st_size;
+    }
+    return fd;
+}
+
+/* path -> path.1 -> ... -> path.N, the oldest one is overwritten */
+static void posix_rotate(void)
+{
+    char from[PATH_MAX];
+    char to[PATH_MAX];
+
+    if (posix_fd >= 0)
+    {
+        if (posix_config.fsync_policy != LOGGING_POSIX_FSYNC_NEVER)
+        {
+            (void)fdatasync(posix_fd);
+        }
+        (void)close(posix_fd);
+    }
+
+    for (unsigned i = posix_config.max_files; i > 0u; i--)
+    {
+        if (i > 1u)
+        {
+            (void)snprintf(from, sizeof(from), "%s.%u", posix_config.path, i - 1u);
+        }
+        else
+        {
+            (void)snprintf(from, sizeof(from), "%s", posix_config.path);
+        }
+        (void)snprintf(to, sizeof(to), "%s.%u", posix_config.path, i);
+        (void)rename(from, to);
+    }
+
+    posix_fd = posix_open_file(1);
+}
+
+static int posix_write_all(struct iovec *batch, size_t count)
+{
+    if (posix_fd < 0)
+    {
+        posix_fd = posix_open_file(0); /* Retry after a failed rotation */
+        if (posix_fd < 0)
+        {
+            return -1;
+        }
+    }
+
+    while (count > 0u)
+    {
+        ssize_t written = writev(posix_fd, batch, (int)count);
+
+        if (written < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            return -1;
+        }
+
+        /* Partial write - skip what went out and continue inside the current record */
+        while ((count > 0u) && ((size_t)written >= batch->iov_len))
+        {
+            written -= (ssize_t)batch->iov_len;
+            batch++;
+            count--;
+        }
+        if (count > 0u)
+        {
+            batch->iov_base = (uint8_t *)batch->iov_base + written;
+            batch->iov_len -= (size_t)written;
+        }
+    }
+    return 0;
+}
+
+static void *posix_writer(void *argument)
+{
+    struct iovec batch[LOGGING_POSIX_BATCH];
+    uint64_t last_sync = posix_now_ms();
+    int dirty = 0;
+
+    (void)argument;
+
+    for (;;)
+    {
+        size_t tail = LOGGING_ATOMIC_LOAD_RELAXED(&posix_tail);
+        size_t count = 0u;
+        size_t bytes = 0u;
+        int error_seen = 0;
+        int sync_now;
+        uint32_t requests;
+        Posix_Slot_t *slot;
+
+        /* Running flag first: records committed before it was cleared are still collected */
+        int running = LOGGING_ATOMIC_LOAD_ACQUIRE(&posix_running);
+
+        /* Busy before the panic check, the panic writer sets them the other way round */
+        LOGGING_ATOMIC_STORE_RELAXED(&posix_writer_busy, 1u);
+        LOGGING_ATOMIC_FENCE_SEQ_CST();
+        if (LOGGING_ATOMIC_LOAD_RELAXED(&posix_panic))
+        {
+            LOGGING_ATOMIC_STORE_RELEASE(&posix_writer_busy, 0u);
+            break; /* The panic writer owns the ring and the file now */
+        }
+
+        while ((count < LOGGING_POSIX_BATCH) && ((slot = posix_peek(tail + count)) != NULL))
+        {
+            /* A batch never crosses a rotation point */
+            if ((count > 0u) && (posix_config.max_file_size > 0u) &&
+                ((posix_file_size + bytes + slot->length) > posix_config.max_file_size))
+            {
+                break;
+            }
+            batch[count].iov_base = slot->data;
+            batch[count].iov_len = slot->length;
+            error_seen |= posix_is_error(slot);
+            bytes += slot->length;
+            count++;
+        }
+
+        if (count > 0u)
+        {
+            if ((posix_config.max_file_size > 0u) && (posix_file_size > 0u) &&
+                ((posix_file_size + bytes) > posix_config.max_file_size))
+            {
+                posix_rotate();
+            }
+
+            if (posix_write_all(batch, count) == 0)
+            {
+                posix_file_size += bytes;
+                dirty = 1;
+            }
+            else
+            {
+                LOGGING_ATOMIC_FETCH_ADD_RELAXED(&posix_dropped, (uint32_t)count);
+            }
+            posix_release(tail, count);
+        }
+
+        requests = LOGGING_ATOMIC_LOAD_ACQUIRE(&posix_sync_requests);
+        sync_now = (requests != posix_sync_done);
+        if (dirty)
+        {
+            switch (posix_config.fsync_policy)
+            {
+            case LOGGING_POSIX_FSYNC_ON_ERROR:
+                sync_now |= error_seen;
+                break;
+            case LOGGING_POSIX_FSYNC_INTERVAL:
+                sync_now |= ((posix_now_ms() - last_sync) >= posix_config.fsync_interval_ms);
+                break;
+            default:
+                break;
+            }
+        }
+        if (sync_now)
+        {
+            if (posix_fd >= 0)
+            {
+                (void)fdatasync(posix_fd);
+            }
+            dirty = 0;
+            last_sync = posix_now_ms();
+            LOGGING_ATOMIC_STORE_RELEASE(&posix_sync_done, requests);
+        }
+        LOGGING_ATOMIC_STORE_RELEASE(&posix_writer_busy, 0u);
+
+        if (count == 0u)
+        {
+            if (!running)
+            {
+                break;
+            }
+            posix_idle();
+        }
+    }
+
+    return NULL;
+}
+
+int Logging_PosixOpen(const Logging_PosixConfig_t *config)
+{
+    int result;
+
+    if ((config == NULL) || (config->path == NULL))
+    {
+        errno = EINVAL;
+        return -1;
+    }
+    if (LOGGING_ATOMIC_LOAD_ACQUIRE(&posix_running))
+    {
+        errno = EBUSY;
+        return -1;
+    }
+
+    posix_config = *config;
+    posix_fd = posix_open_file(0);
+    if (posix_fd < 0)
+    {
+        return -1;
+    }
+
+    LOGGING_ATOMIC_STORE_RELEASE(&posix_running, 1);
+    result = pthread_create(&posix_thread, NULL, posix_writer, NULL);
+    if (result != 0)
+    {
+        LOGGING_ATOMIC_STORE_RELEASE(&posix_running, 0);
+        (void)close(posix_fd);
+        posix_fd = -1;
+        errno = result;
+        return -1;
+    }
+
+    return 0;
+}
+
+int Logging_PosixWrite(const uint8_t *data, size_t length)
+{
+    size_t position;
+    size_t index;
+    Posix_Slot_t *slot;
+
+    if (!LOGGING_ATOMIC_LOAD_ACQUIRE(&posix_running))
+    {
+        return 0;
+    }
+    if (length > LOGGING_POSIX_RECORD_SIZE)
+    {
+        length = LOGGING_POSIX_RECORD_SIZE;
+    }
+
+    position = LOGGING_ATOMIC_LOAD_RELAXED(&posix_head);
+    for (;;)
+    {
+        size_t sequence;
+
+        index = position & POSIX_QUEUE_MASK;
+        slot = &posix_queue[index];
+        sequence = LOGGING_ATOMIC_LOAD_ACQUIRE(&slot->sequence) + index;
+
+        if (sequence == position)
+        {
+            if (LOGGING_ATOMIC_CAS_WEAK(&posix_head, &position, position + 1u))
+            {
+                break;
+            }
+        }
+        else if ((intptr_t)(sequence - position) < 0)
+        {
+            /* Slot still holds a record the writer has not reached */
+            LOGGING_ATOMIC_FETCH_ADD_RELAXED(&posix_dropped, 1u);
+            return 0;
+        }
+        else
+        {
+            position = LOGGING_ATOMIC_LOAD_RELAXED(&posix_head);
+        }
+    }
+
+    memcpy(slot->data, data, length);
+    slot->length = (uint16_t)length;
+    LOGGING_ATOMIC_STORE_RELEASE(&slot->sequence, position + 1u - index);
+
+    return (int)length;
+}
+
+int Logging_PosixFlush(void)
+{
+    size_t head;
+    uint32_t request;
+
+    if (!LOGGING_ATOMIC_LOAD_ACQUIRE(&posix_running) || LOGGING_ATOMIC_LOAD_ACQUIRE(&posix_panic))
+    {
+        return -1;
+    }
+
+    /* Everything reserved so far, records still being copied are waited for as well */
+    head = LOGGING_ATOMIC_LOAD_RELAXED(&posix_head);
+    while ((intptr_t)(LOGGING_ATOMIC_LOAD_ACQUIRE(&posix_tail) - head) < 0)
+    {
+        posix_idle();
+    }
+
+    request = LOGGING_ATOMIC_FETCH_ADD_RELAXED(&posix_sync_requests, 1u) + 1u;
+    while ((int32_t)(LOGGING_ATOMIC_LOAD_ACQUIRE(&posix_sync_done) - request) < 0)
+    {
+        posix_idle();
+    }
+
+    return 0;
+}
+
+/* Bounded: a handler running on the writer thread itself would wait forever */
+static void posix_wait_writer(void)
+{
+    uint64_t start = posix_now_ms();
+
+    while (LOGGING_ATOMIC_LOAD_ACQUIRE(&posix_writer_busy) &&
+           ((posix_now_ms() - start) < LOGGING_POSIX_PANIC_WAIT_MS))
+    {
+        posix_idle();
+    }
+}
+
+int Logging_PosixPanicWrite(const uint8_t *data, size_t length)
+{
+    struct iovec record;
+    Posix_Slot_t *slot;
+    int result;
+
+    if (!LOGGING_ATOMIC_LOAD_ACQUIRE(&posix_running))
+    {
+        return 0;
+    }
+
+    /* The batch being written is finished by the writer thread, which then stops */
+    LOGGING_ATOMIC_STORE_RELAXED(&posix_panic, 1u);
+    LOGGING_ATOMIC_FENCE_SEQ_CST();
+    posix_wait_writer();
+
+    /* Queued records first; a nested call (signal in a signal handler) skips straight to its own */
+    if (LOGGING_ATOMIC_EXCHANGE_ACQUIRE(&posix_panic_busy, 1u) == 0u)
+    {
+        size_t tail = LOGGING_ATOMIC_LOAD_RELAXED(&posix_tail);
+
+        while ((slot = posix_peek(tail)) != NULL)
+        {
+            record.iov_base = slot->data;
+            record.iov_len = slot->length;
+            (void)posix_write_all(&record, 1u);
+            posix_release(tail, 1u);
+            tail++;
+        }
+        LOGGING_ATOMIC_STORE_RELEASE(&posix_panic_busy, 0u);
+    }
+
+    record.iov_base = (void *)(uintptr_t)data;
+    record.iov_len = length;
+    result = posix_write_all(&record, 1u);
+
+    if ((posix_fd >= 0) && (posix_config.fsync_policy != LOGGING_POSIX_FSYNC_NEVER))
+    {
+        (void)fdatasync(posix_fd);
+    }
+
+    return (result == 0) ? (int)length : 0;
+}
+
+void Logging_PosixClose(void)
+{
+    if (!LOGGING_ATOMIC_LOAD_ACQUIRE(&posix_running))
+    {
+        return;
+    }
+
+    LOGGING_ATOMIC_STORE_RELEASE(&posix_running, 0);
+    (void)pthread_join(posix_thread, NULL);
+
+    if (posix_fd >= 0)
+    {
+        if (posix_config.fsync_policy != LOGGING_POSIX_FSYNC_NEVER)
+        {
+            (void)fdatasync(posix_fd);
+        }
+        (void)close(posix_fd);
+        posix_fd = -1;
+    }
+}
+
+uint32_t Logging_GetPosixDropped(void)
+{
+    return LOGGING_ATOMIC_LOAD_RELAXED(&posix_dropped);
+}
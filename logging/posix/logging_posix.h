@@ -0,0 +1,177 @@
+/**
+ * @file: logging_posix.h
+ * @author: Paweł Kawula (pawel.kawula@kelectronics.pl)
+ * @brief: Asynchronous file output for Linux hosts - background writer thread, batched writev
+ * -----
+ * Copyright 2025 - KElectronics
+ * -----
+ * @note: Built as the separate logging_posix library. Logging_PosixWrite()
+ *        is a Logging_WriteFunction_t: producers copy the formatted line (or
+ *        a tokenized / key/value frame) into a lock-free multi-producer ring
+ *        and return - no lock, no syscall. A writer thread collects the
+ *        queued records into one writev() per batch, rotates the file by
+ *        size and applies the fsync policy. When the ring is full the record
+ *        is dropped and counted, producers never wait for the disk.
+ */
+
+#ifndef LOGGING_POSIX_H
+#define LOGGING_POSIX_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "logging.h"
+
+/**
+ * @brief Largest record kept by the ring, longer records are truncated.
+ *
+ * Matches the buffer Logging_InitWrite() formats into by default.
+ */
+#ifndef LOGGING_POSIX_RECORD_SIZE
+#define LOGGING_POSIX_RECORD_SIZE LOGGING_WRITE_BUFFER_SIZE
+#endif
+
+/**
+ * @brief Number of ring slots (power of two), each LOGGING_POSIX_RECORD_SIZE bytes.
+ */
+#ifndef LOGGING_POSIX_QUEUE_LEN
+#define LOGGING_POSIX_QUEUE_LEN 16384
+#endif
+
+/**
+ * @brief Most records written by one writev() call (at most IOV_MAX).
+ */
+#ifndef LOGGING_POSIX_BATCH
+#define LOGGING_POSIX_BATCH 256
+#endif
+
+/**
+ * @brief Writer thread sleep when the ring is empty, in microseconds.
+ */
+#ifndef LOGGING_POSIX_IDLE_US
+#define LOGGING_POSIX_IDLE_US 1000
+#endif
+
+/**
+ * @brief Longest wait of Logging_PosixPanicWrite() for the writer thread to finish its batch, in milliseconds.
+ */
+#ifndef LOGGING_POSIX_PANIC_WAIT_MS
+#define LOGGING_POSIX_PANIC_WAIT_MS 100
+#endif
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * @brief When the written data is forced to the storage device.
+ */
+typedef enum
+{
+    LOGGING_POSIX_FSYNC_NEVER = 0, /**< Left to the kernel page cache */
+    LOGGING_POSIX_FSYNC_ON_ERROR,  /**< After every batch holding an "[ERROR]" line */
+    LOGGING_POSIX_FSYNC_INTERVAL   /**< At most every fsync_interval_ms while data is written */
+} Logging_PosixFsync_t;
+
+/**
+ * @brief File output configuration.
+ */
+typedef struct
+{
+    const char *path;                  /**< Log file, opened for appending */
+    size_t max_file_size;              /**< Rotate before the file grows past this size, 0 never rotates */
+    unsigned max_files;                /**< Rotated files kept as path.1 ... path.N, 0 restarts the file */
+    Logging_PosixFsync_t fsync_policy; /**< See Logging_PosixFsync_t */
+    unsigned fsync_interval_ms;        /**< Period of LOGGING_POSIX_FSYNC_INTERVAL */
+} Logging_PosixConfig_t;
+
+/**
+ * @brief Open the log file and start the writer thread.
+ *
+ * @param config File output configuration, copied (path must stay valid until Logging_PosixClose()).
+ * @return int 0 on success, -1 on error (already open, open() or pthread_create() failed; errno is set).
+ *
+ * @example
+ * @code
+ * static const Logging_PosixConfig_t log_file = {
+ *     .path = "/var/log/gateway.log",
+ *     .max_file_size = 8u * 1024u * 1024u,
+ *     .max_files = 4,
+ *     .fsync_policy = LOGGING_POSIX_FSYNC_ON_ERROR,
+ * };
+ *
+ * int main(void) {
+ *     Logging_PosixOpen(&log_file);
+ *     Logging_InitWrite(Logging_PosixWrite);   // or Logging_AddSink(Logging_PosixWrite, mask)
+ *     LogInfo("Gateway started");
+ *     ...
+ *     Logging_PosixClose();
+ * }
+ * @endcode
+ */
+int Logging_PosixOpen(const Logging_PosixConfig_t *config);
+
+/**
+ * @brief Queue one record for the writer thread, callable from any thread.
+ *
+ * @param data   Record bytes.
+ * @param length Number of bytes, cut to LOGGING_POSIX_RECORD_SIZE.
+ * @return int Number of bytes queued, 0 when dropped (ring full or file not open).
+ */
+int Logging_PosixWrite(const uint8_t *data, size_t length);
+
+/**
+ * @brief Wait until everything queued before the call is written and synced to storage.
+ *
+ * For shutdown paths and before a deliberate reset. Blocks the caller,
+ * not the producers.
+ *
+ * @return int 0 on success, -1 when the file is not open.
+ */
+int Logging_PosixFlush(void);
+
+/**
+ * @brief Write one record to the file from the caller, a panic writer for Logging_EnterPanic().
+ *
+ * The first call stops the writer thread and waits until it has finished
+ * the batch it was writing (at most LOGGING_POSIX_PANIC_WAIT_MS, for a
+ * fault on the writer thread itself); every call then writes the records
+ * still queued, then its own record, and syncs unless the policy is
+ * LOGGING_POSIX_FSYNC_NEVER. Uses only async-signal-safe calls (writev(),
+ * open(), fdatasync(), nanosleep()), so it can run in a SIGSEGV / SIGABRT
+ * handler. The file is no longer rotated. Logging_PosixFlush() fails
+ * afterwards, Logging_PosixClose() still closes the file.
+ *
+ * @param data   Record bytes.
+ * @param length Number of bytes.
+ * @return int Number of bytes written, 0 when the file is not open or the write failed.
+ *
+ * @example
+ * @code
+ * static void crash_handler(int signal_number) {
+ *     Logging_EnterPanic(Logging_PosixPanicWrite);
+ *     LogError("Fatal signal %d", signal_number);
+ *     _exit(128 + signal_number);
+ * }
+ * @endcode
+ */
+int Logging_PosixPanicWrite(const uint8_t *data, size_t length);
+
+/**
+ * @brief Write the pending records, stop the writer thread and close the file.
+ */
+void Logging_PosixClose(void);
+
+/**
+ * @brief Get the number of records lost because the ring was full or the write failed.
+ *
+ * @return uint32_t Dropped record counter since startup.
+ */
+uint32_t Logging_GetPosixDropped(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LOGGING_POSIX_H */
@@ -0,0 +1,322 @@
+/**
+ * @file: logging_udp.c
+ * @author:: Paweł Kawula (pawel.kawula@kelectronics.pl)
+ * -----
+ * Copyright 2025 - KElectronics
+ */
+
+#define _GNU_SOURCE /* sendmmsg() */
+
+#include <errno.h>
+#include <netdb.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <sys/uio.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "logging_udp.h"
+#include "logging_atomic.h"
+
+/* "1 " TIMESTAMP SP HOSTNAME (255) SP APP-NAME (48) SP PROCID SP "- - " */
+#define UDP_SYSLOG_HEADER_SIZE 384u
+
+/* Syslog datagrams handed to the kernel by one sendmmsg() call */
+#define UDP_SYSLOG_VECTOR 16u
+
+/* Room for PRI, the syslog header and some message in every datagram */
+#if (LOGGING_UDP_DATAGRAM_SIZE < 512) || (LOGGING_UDP_DATAGRAM_SIZE > 65507)
+#error "LOGGING_UDP_DATAGRAM_SIZE must be in range 512..65507."
+#endif
+
+static int udp_fd = -1;
+static Logging_UdpConfig_t udp_config;
+static char udp_hostname[256];
+static uint32_t udp_sequence = 0;
+static uint32_t udp_dropped = 0;
+static uint32_t udp_datagrams = 0;
+
+/* Binary datagram being packed by Logging_UdpSend(), single caller */
+static uint8_t udp_datagram[LOGGING_UDP_DATAGRAM_SIZE];
+static size_t udp_fill = 0;
+static size_t udp_records = 0;
+
+/* Transmit the packed binary datagram without waiting for the socket */
+static int udp_transmit(void)
+{
+    int sent = 0;
+
+    if (udp_records == 0u)
+    {
+        return 0;
+    }
+
+    if (send(udp_fd, udp_datagram, udp_fill, MSG_DONTWAIT | MSG_NOSIGNAL) == (ssize_t)udp_fill)
+    {
+        LOGGING_ATOMIC_FETCH_ADD_RELAXED(&udp_datagrams, 1u);
+        sent = 1;
+    }
+    else
+    {
+        LOGGING_ATOMIC_FETCH_ADD_RELAXED(&udp_dropped, (uint32_t)udp_records);
+    }
+
+    udp_fill = 0u;
+    udp_records = 0u;
+    return sent;
+}
+
+/* RFC 5424 severity of a log line, from its level tag */
+static unsigned udp_severity(const uint8_t *data, size_t length)
+{
+    if ((length < 2u) || (data[0] != '['))
+    {
+        return 5u; /* Notice */
+    }
+
+    switch (data[1])
+    {
+        case 'E':
+            return 3u;
+        case 'W':
+            return 4u;
+        case 'I':
+            return 6u;
+        case 'D':
+            return 7u;
+        default:
+            return 5u;
+    }
+}
+
+/* Everything after PRI, identical for all records of one call */
+static size_t udp_syslog_header(char *header, size_t size)
+{
+    struct timespec now;
+    struct tm utc;
+    char timestamp[40];
+    int length;
+
+    clock_gettime(CLOCK_REALTIME, &now);
+    gmtime_r(&now.tv_sec, &utc);
+    (void)strftime(timestamp, sizeof(timestamp), "%Y-%m-%dT%H:%M:%S", &utc);
+
+    length = snprintf(header, size, "1 %s.%06ldZ %s %s %ld - - ", timestamp, now.tv_nsec / 1000L, udp_hostname,
+                      (udp_config.app_name != NULL) ? udp_config.app_name : "-", (long)getpid());
+
+    return ((length < 0) || ((size_t)length >= size)) ? 0u : (size_t)length;
+}
+
+/* One syslog datagram: PRI, the shared header and the record itself, gathered without copying */
+typedef struct
+{
+    char pri[8];
+    struct iovec parts[3];
+} Udp_Syslog_Datagram_t;
+
+/* RFC 5426: exactly one message per datagram, a batch still costs one syscall per UDP_SYSLOG_VECTOR records */
+static int udp_send_syslog(const Logging_Span_t *records, size_t count)
+{
+    char header[UDP_SYSLOG_HEADER_SIZE];
+    size_t header_length = udp_syslog_header(header, sizeof(header));
+    Udp_Syslog_Datagram_t datagrams[UDP_SYSLOG_VECTOR];
+    struct mmsghdr vector[UDP_SYSLOG_VECTOR];
+    int sent_total = 0;
+    size_t i = 0;
+
+    while (i < count)
+    {
+        unsigned queued = 0;
+        int sent;
+
+        for (; (i < count) && (queued < UDP_SYSLOG_VECTOR); i++, queued++)
+        {
+            Udp_Syslog_Datagram_t *datagram = &datagrams[queued];
+            const uint8_t *message = records[i].data;
+            size_t length = records[i].length;
+            size_t pri_length;
+
+            /* The datagram delimits the message, the line ending is not part of MSG */
+            while ((length > 0u) && ((message[length - 1u] == '\n') || (message[length - 1u] == '\r')))
+            {
+                length--;
+            }
+
+            pri_length = (size_t)snprintf(datagram->pri, sizeof(datagram->pri), "<%u>",
+                                          ((unsigned)udp_config.facility * 8u) + udp_severity(message, length));
+            if ((pri_length + header_length + length) > LOGGING_UDP_DATAGRAM_SIZE)
+            {
+                length = LOGGING_UDP_DATAGRAM_SIZE - pri_length - header_length;
+            }
+
+            datagram->parts[0].iov_base = datagram->pri;
+            datagram->parts[0].iov_len = pri_length;
+            datagram->parts[1].iov_base = header;
+            datagram->parts[1].iov_len = header_length;
+            datagram->parts[2].iov_base = (void *)(uintptr_t)message;
+            datagram->parts[2].iov_len = length;
+
+            memset(&vector[queued], 0, sizeof(vector[queued]));
+            vector[queued].msg_hdr.msg_iov = datagram->parts;
+            vector[queued].msg_hdr.msg_iovlen = 3;
+        }
+
+        sent = sendmmsg(udp_fd, vector, queued, MSG_DONTWAIT | MSG_NOSIGNAL);
+        if (sent < 0)
+        {
+            sent = 0;
+        }
+
+        LOGGING_ATOMIC_FETCH_ADD_RELAXED(&udp_datagrams, (uint32_t)sent);
+        LOGGING_ATOMIC_FETCH_ADD_RELAXED(&udp_dropped, (uint32_t)(queued - (unsigned)sent));
+        sent_total += sent;
+    }
+
+    return sent_total;
+}
+
+static int udp_send_binary(const Logging_Span_t *records, size_t count)
+{
+    int datagrams = 0;
+    size_t i;
+
+    for (i = 0; i < count; i++)
+    {
+        size_t length = records[i].length;
+
+        if ((2u + length) > (LOGGING_UDP_DATAGRAM_SIZE - LOGGING_UDP_HEADER_SIZE))
+        {
+            LOGGING_ATOMIC_FETCH_ADD_RELAXED(&udp_dropped, 1u); /* Binary records are not cut */
+            continue;
+        }
+        if ((udp_fill + 2u + length) > LOGGING_UDP_DATAGRAM_SIZE)
+        {
+            datagrams += udp_transmit();
+        }
+
+        if (udp_fill == 0u)
+        {
+            uint32_t sequence = udp_sequence++;
+
+            udp_datagram[0] = (uint8_t)'L';
+            udp_datagram[1] = (uint8_t)'B';
+            udp_datagram[2] = (uint8_t)LOGGING_UDP_VERSION;
+            udp_datagram[3] = 0u;
+            udp_datagram[4] = (uint8_t)sequence;
+            udp_datagram[5] = (uint8_t)(sequence >> 8);
+            udp_datagram[6] = (uint8_t)(sequence >> 16);
+            udp_datagram[7] = (uint8_t)(sequence >> 24);
+            udp_fill = LOGGING_UDP_HEADER_SIZE;
+        }
+
+        udp_datagram[udp_fill++] = (uint8_t)length;
+        udp_datagram[udp_fill++] = (uint8_t)(length >> 8);
+        memcpy(&udp_datagram[udp_fill], records[i].data, length);
+        udp_fill += length;
+        udp_records++;
+    }
+
+    return datagrams + udp_transmit();
+}
+
+int Logging_UdpOpen(const Logging_UdpConfig_t *config)
+{
+    struct addrinfo hints;
+    struct addrinfo *addresses;
+    struct addrinfo *address;
+    char port[8];
+    int fd = -1;
+    int error;
+
+    if ((config == NULL) || (config->host == NULL) || (config->port == 0u) || (config->facility > 23u) ||
+        ((config->format != LOGGING_UDP_SYSLOG) && (config->format != LOGGING_UDP_BINARY)))
+    {
+        errno = EINVAL;
+        return -1;
+    }
+    if (udp_fd >= 0)
+    {
+        errno = EBUSY;
+        return -1;
+    }
+
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_DGRAM;
+    (void)snprintf(port, sizeof(port), "%u", (unsigned)config->port);
+
+    error = getaddrinfo(config->host, port, &hints, &addresses);
+    if (error != 0)
+    {
+        errno = (error == EAI_SYSTEM) ? errno : EHOSTUNREACH;
+        return -1;
+    }
+
+    /* Connected socket: send() without an address, ICMP errors reported back */
+    for (address = addresses; (address != NULL) && (fd < 0); address = address->ai_next)
+    {
+        fd = socket(address->ai_family, address->ai_socktype | SOCK_CLOEXEC, address->ai_protocol);
+        if ((fd >= 0) && (connect(fd, address->ai_addr, address->ai_addrlen) != 0))
+        {
+            (void)close(fd);
+            fd = -1;
+        }
+    }
+    freeaddrinfo(addresses);
+
+    if (fd < 0)
+    {
+        return -1;
+    }
+
+    udp_config = *config;
+    if (config->hostname != NULL)
+    {
+        (void)snprintf(udp_hostname, sizeof(udp_hostname), "%s", config->hostname);
+    }
+    else if (gethostname(udp_hostname, sizeof(udp_hostname)) != 0)
+    {
+        (void)snprintf(udp_hostname, sizeof(udp_hostname), "-");
+    }
+    udp_hostname[sizeof(udp_hostname) - 1u] = '\0';
+    udp_fill = 0u;
+    udp_records = 0u;
+    udp_fd = fd;
+
+    return 0;
+}
+
+int Logging_UdpSend(const Logging_Span_t *records, size_t count)
+{
+    if (udp_fd < 0)
+    {
+        LOGGING_ATOMIC_FETCH_ADD_RELAXED(&udp_dropped, (uint32_t)count);
+        return 0;
+    }
+
+    return (udp_config.format == LOGGING_UDP_BINARY) ? udp_send_binary(records, count)
+                                                     : udp_send_syslog(records, count);
+}
+
+void Logging_UdpClose(void)
+{
+    if (udp_fd >= 0)
+    {
+        (void)close(udp_fd);
+        udp_fd = -1;
+    }
+}
+
+uint32_t Logging_GetUdpDropped(void)
+{
+    return LOGGING_ATOMIC_LOAD_RELAXED(&udp_dropped);
+}
+
+uint32_t Logging_GetUdpDatagrams(void)
+{
+    return LOGGING_ATOMIC_LOAD_RELAXED(&udp_datagrams);
+}
@@ -0,0 +1,139 @@
+/**
+ * @file: logging_udp.h
+ * @author: Paweł Kawula (pawel.kawula@kelectronics.pl)
+ * @brief: Network forwarding - batches sent as UDP datagrams, RFC 5424 syslog or binary
+ * -----
+ * Copyright 2025 - KElectronics
+ * -----
+ * @note: Part of the logging_posix library. Logging_UdpSend() is a
+ *        Logging_BatchFunction_t: registered with Logging_InitBatch(), it
+ *        sends the records of a batch as datagrams of at most
+ *        LOGGING_UDP_DATAGRAM_SIZE bytes without blocking. When batches are delivered (fill level, flush-on-ERROR,
+ *        flush interval) is decided by the batching stage, see
+ *        LOGGING_BATCH_FLUSH_LEVEL and LOGGING_BATCH_FLUSH_INTERVAL_MS.
+ *
+ *        LOGGING_UDP_SYSLOG datagram: exactly one RFC 5424 message (RFC 5426),
+ *        one datagram per record, a batch handed over with one sendmmsg()
+ *        <PRI>1 TIMESTAMP HOSTNAME APP-NAME PROCID - - MSG
+ *
+ *        LOGGING_UDP_BINARY datagram (multi-byte values little endian):
+ *        u8 'L' | u8 'B' | u8 LOGGING_UDP_VERSION | u8 0 | u32 sequence
+ *        then per record: u16 length | length bytes (formatted line,
+ *        tokenized frame or key/value record, as handed to the batch)
+ */
+
+#ifndef LOGGING_UDP_H
+#define LOGGING_UDP_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "logging.h"
+
+#define LOGGING_UDP_VERSION 1u
+
+/* Size of the LOGGING_UDP_BINARY datagram header */
+#define LOGGING_UDP_HEADER_SIZE 8u
+
+/**
+ * @brief Largest datagram payload, defaults to one Ethernet frame without fragmentation.
+ */
+#ifndef LOGGING_UDP_DATAGRAM_SIZE
+#define LOGGING_UDP_DATAGRAM_SIZE 1472
+#endif
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * @brief Datagram content.
+ */
+typedef enum
+{
+    LOGGING_UDP_SYSLOG = 0, /**< RFC 5424 text, for syslog collectors */
+    LOGGING_UDP_BINARY      /**< Length-prefixed records under a sequence numbered header */
+} Logging_UdpFormat_t;
+
+/**
+ * @brief Forwarding configuration.
+ */
+typedef struct
+{
+    const char *host;           /**< Collector name or address (IPv4 / IPv6) */
+    uint16_t port;              /**< Collector port, e.g. 514 for syslog */
+    Logging_UdpFormat_t format; /**< See Logging_UdpFormat_t */
+    uint8_t facility;           /**< Syslog facility 0..23 (16 = local0) */
+    const char *hostname;       /**< Syslog HOSTNAME, NULL for gethostname() */
+    const char *app_name;       /**< Syslog APP-NAME, NULL for "-" */
+} Logging_UdpConfig_t;
+
+/**
+ * @brief Resolve the collector and open the socket.
+ *
+ * @param config Forwarding configuration, copied (strings must stay valid until Logging_UdpClose()).
+ * @return int 0 on success, -1 on error (already open, invalid configuration, name resolution or socket() failed; errno is set).
+ *
+ * @example
+ * @code
+ * // LOGGING_BATCH, LOGGING_BATCH_BUFFER_SIZE=1400, LOGGING_BATCH_FLUSH_LEVEL=LOG_ERROR,
+ * // LOGGING_BATCH_FLUSH_INTERVAL_MS=200
+ * static const Logging_UdpConfig_t log_collector = {
+ *     .host = "logs.fleet.example",
+ *     .port = 514,
+ *     .format = LOGGING_UDP_SYSLOG,
+ *     .facility = 16,
+ *     .app_name = "gateway",
+ * };
+ *
+ * int main(void) {
+ *     Logging_UdpOpen(&log_collector);
+ *     Logging_InitBatch(Logging_UdpSend);
+ *     LogInfo("Gateway started");
+ *     ...
+ *     Logging_BatchFlush();
+ *     Logging_UdpClose();
+ * }
+ * @endcode
+ */
+int Logging_UdpOpen(const Logging_UdpConfig_t *config);
+
+/**
+ * @brief Send one batch, a Logging_BatchFunction_t.
+ *
+ * Called by the batching stage from one context at a time. A syslog record
+ * longer than a datagram is truncated, such a binary record is dropped.
+ *
+ * @param records Records in logging order.
+ * @param count   Number of records.
+ * @return int Number of datagrams sent.
+ */
+int Logging_UdpSend(const Logging_Span_t *records, size_t count);
+
+/**
+ * @brief Close the socket.
+ *
+ * @note Deliver the last batch first (Logging_BatchFlush()), must not race with Logging_UdpSend().
+ */
+void Logging_UdpClose(void);
+
+/**
+ * @brief Get the number of records lost because a send failed or would have blocked.
+ *
+ * @return uint32_t Dropped record counter since startup.
+ */
+uint32_t Logging_GetUdpDropped(void);
+
+/**
+ * @brief Get the number of datagrams sent, the packet rate seen by the network.
+ *
+ * @return uint32_t Datagram counter since startup.
+ */
+uint32_t Logging_GetUdpDatagrams(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LOGGING_UDP_H */
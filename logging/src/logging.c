@@ -7,30 +7,119 @@
 
 #include <stdarg.h>
 #include <stddef.h>
+#include <stdint.h>
 
 #include "logging.h"
+#include "logging_internal.h"
 #include "logging_levels.h"
 
-int (*log_function)(const char *message, ...) = NULL;
+#if LOGGING_WRITE_BUFFER_SIZE < 4
+#error "LOGGING_WRITE_BUFFER_SIZE must be at least 4."
+#endif
 
-static int default_log_function(const char *message, ...)
+/* Never NULL - log macros used before Logging_Init() go to the no-op sink */
+int (*log_function)(const char *message, ...) = logging_default_log_function;
+
+static Logging_VFunction_t vlog_function = NULL;
+static Logging_WriteFunction_t write_function = NULL;
+
+int logging_default_log_function(const char *message, ...)
 {
     (void)message;
     return 0;
 }
 
+/* Library entry point for va_list functions: the only place arguments are started */
+static int vlog_entry(const char *message, ...)
+{
+    int result;
+    va_list args;
+
+    va_start(args, message);
+    result = Logging_VLog(message, args);
+    va_end(args);
+
+    return result;
+}
+
+/* Entry point for byte outputs: format with the built-in formatter, then write */
+static int write_entry(const char *message, ...)
+{
+    char buffer[LOGGING_WRITE_BUFFER_SIZE];
+    Logging_WriteFunction_t write = write_function;
+    size_t length;
+    va_list args;
+
+    if (write == NULL)
+    {
+        return 0;
+    }
+
+    va_start(args, message);
+    length = logging_format_line(buffer, sizeof(buffer), message, args);
+    va_end(args);
+
+    return write((const uint8_t *)buffer, length);
+}
+
 void Logging_Init(Logging_Function_t log_func)
 {
+    vlog_function = NULL;
+
     if (log_func)
     {
-        log_function = log_func;
+        logging_set_sink(log_func);
+    }
+    else
+    {
+        logging_set_sink(logging_default_log_function);
+    }
+}
+
+void Logging_InitV(Logging_VFunction_t vlog_func)
+{
+    if (vlog_func)
+    {
+        vlog_function = vlog_func;
+        logging_set_sink(vlog_entry);
+    }
+    else
+    {
+        Logging_Init(NULL);
+    }
+}
+
+Logging_Function_t Logging_SwapSink(Logging_Function_t log_func)
+{
+    return LOGGING_ATOMIC_EXCHANGE_ACQ_REL(&log_function, log_func ? log_func : logging_default_log_function);
+}
+
+void Logging_InitWrite(Logging_WriteFunction_t write_func)
+{
+    if (write_func)
+    {
+        vlog_function = NULL;
+        write_function = write_func;
+        logging_set_sink(write_entry);
     }
     else
     {
-        log_function = default_log_function;
+        Logging_Init(NULL);
     }
 }
 
+int Logging_VLog(const char *message, va_list args)
+{
+    Logging_VFunction_t vlog = vlog_function;
+
+    if (vlog == NULL)
+    {
+        return 0;
+    }
+
+    return vlog(message, args);
+}
+
 const char *Logging_GetVersion(void)
 {
     return LOGGING_VERSION;
@@ -55,6 +144,21 @@ char * Logging_GetLoggingLevelName(int level)
     }
 }
 
+#ifdef LOGGING_TIMESTAMP
+uint64_t Logging_TimestampToMicroseconds(Logging_Timestamp_t ticks)
+{
+#if LOGGING_TIMESTAMP_HZ > 0
+    uint64_t value = (uint64_t)ticks;
+
+    /* Split to avoid overflowing value * 1000000 for large tick counts */
+    return ((value / LOGGING_TIMESTAMP_HZ) * 1000000u) +
+           (((value % LOGGING_TIMESTAMP_HZ) * 1000000u) / LOGGING_TIMESTAMP_HZ);
+#else
+    return (uint64_t)ticks;
+#endif
+}
+#endif
+
 int Logging_GetTopLoggingLevel(void)
 {
     return LOGGING_TOP_LOG_LEVEL;
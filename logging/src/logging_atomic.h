@@ -0,0 +1,37 @@
+/**
+ * @file: logging_atomic.h
+ * @author: Paweł Kawula (pawel.kawula@kelectronics.pl)
+ * @brief: Internal atomic helpers used by the lock-free logging backends
+ * -----
+ * Copyright 2025 - KElectronics
+ * -----
+ * @note: Library is built as C99, so the GCC/Clang __atomic builtins are used
+ *        instead of C11 <stdatomic.h>. Not part of the public interface.
+ */
+
+#ifndef LOGGING_ATOMIC_H
+#define LOGGING_ATOMIC_H
+
+#if !defined(__GNUC__) && !defined(__clang__)
+#error "Logging atomic helpers require GCC or Clang __atomic builtins."
+#endif
+
+#define LOGGING_ATOMIC_LOAD_RELAXED(ptr) __atomic_load_n((ptr), __ATOMIC_RELAXED)
+#define LOGGING_ATOMIC_LOAD_ACQUIRE(ptr) __atomic_load_n((ptr), __ATOMIC_ACQUIRE)
+
+#define LOGGING_ATOMIC_STORE_RELAXED(ptr, value) __atomic_store_n((ptr), (value), __ATOMIC_RELAXED)
+#define LOGGING_ATOMIC_STORE_RELEASE(ptr, value) __atomic_store_n((ptr), (value), __ATOMIC_RELEASE)
+
+#define LOGGING_ATOMIC_FETCH_ADD_RELAXED(ptr, value) __atomic_fetch_add((ptr), (value), __ATOMIC_RELAXED)
+
+#define LOGGING_ATOMIC_EXCHANGE_ACQUIRE(ptr, value) __atomic_exchange_n((ptr), (value), __ATOMIC_ACQUIRE)
+#define LOGGING_ATOMIC_EXCHANGE_ACQ_REL(ptr, value) __atomic_exchange_n((ptr), (value), __ATOMIC_ACQ_REL)
+
+/* Full barrier, orders a store before a following load */
+#define LOGGING_ATOMIC_FENCE_SEQ_CST() __atomic_thread_fence(__ATOMIC_SEQ_CST)
+
+/* Weak CAS, on failure *expected is updated with the current value */
+#define LOGGING_ATOMIC_CAS_WEAK(ptr, expected, desired) \
+    __atomic_compare_exchange_n((ptr), (expected), (desired), 1, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED)
+
+#endif /* LOGGING_ATOMIC_H */
@@ -0,0 +1,222 @@
+/**
+ * @file: logging_batch.c
+ * @author:: Paweł Kawula (pawel.kawula@kelectronics.pl)
+ * -----
+ * Copyright 2025 - KElectronics
+ */
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "logging.h"
+#include "logging_atomic.h"
+#include "logging_internal.h"
+
+#ifdef LOGGING_BATCH
+
+#if LOGGING_BATCH_BUFFER_SIZE < 4
+#error "LOGGING_BATCH_BUFFER_SIZE must be at least 4."
+#endif
+
+#if LOGGING_BATCH_MAX_RECORDS < 1
+#error "LOGGING_BATCH_MAX_RECORDS must be at least 1."
+#endif
+
+/* Records back to back, each formatted line's NUL is overwritten by the next one */
+static char batch_buffer[LOGGING_BATCH_BUFFER_SIZE];
+static Logging_Span_t batch_records[LOGGING_BATCH_MAX_RECORDS];
+static size_t batch_fill = 0;
+static size_t batch_count = 0;
+static uint8_t batch_busy = 0; /* Held while the batch is appended to or delivered */
+static uint32_t batch_dropped = 0;
+static Logging_BatchFunction_t batch_function = NULL;
+#if LOGGING_BATCH_FLUSH_INTERVAL_MS > 0
+static uint32_t batch_started = 0; /* LOGGING_BATCH_CLOCK() at the first record of the batch */
+#endif
+
+/* Hand the pending records to the transport, batch_busy held */
+static void batch_deliver(void)
+{
+    Logging_BatchFunction_t deliver = batch_function;
+
+    if ((batch_count > 0u) && (deliver != NULL))
+    {
+        (void)deliver(batch_records, batch_count);
+    }
+
+    batch_fill = 0u;
+    batch_count = 0u;
+}
+
+/* Make room for one more record of up to length bytes (NUL included), batch_busy held */
+static size_t batch_room(size_t length)
+{
+    if ((batch_count == LOGGING_BATCH_MAX_RECORDS) || ((batch_fill + length) > LOGGING_BATCH_BUFFER_SIZE))
+    {
+        batch_deliver();
+    }
+
+    return LOGGING_BATCH_BUFFER_SIZE - batch_fill;
+}
+
+static void batch_append(size_t length)
+{
+#if LOGGING_BATCH_FLUSH_INTERVAL_MS > 0
+    if (batch_count == 0u)
+    {
+        batch_started = (uint32_t)LOGGING_BATCH_CLOCK();
+    }
+#endif
+    batch_records[batch_count].data = (const uint8_t *)&batch_buffer[batch_fill];
+    batch_records[batch_count].length = length;
+    batch_fill += length;
+    batch_count++;
+}
+
+/* The partial batch has waited long enough, always when no interval is configured */
+static int batch_due(void)
+{
+#if LOGGING_BATCH_FLUSH_INTERVAL_MS > 0
+    return (uint32_t)((uint32_t)LOGGING_BATCH_CLOCK() - batch_started) >= (uint32_t)LOGGING_BATCH_FLUSH_INTERVAL_MS;
+#else
+    return 1;
+#endif
+}
+
+/* Installed as log_function by Logging_InitBatch() */
+static int batch_entry(const char *message, ...)
+{
+    int level = logging_message_level(message);
+    size_t room;
+    size_t length;
+    va_list args;
+    va_list retry;
+
+    if (LOGGING_ATOMIC_EXCHANGE_ACQUIRE(&batch_busy, 1u) != 0u)
+    {
+        LOGGING_ATOMIC_FETCH_ADD_RELAXED(&batch_dropped, 1u);
+        return -1;
+    }
+
+    room = batch_room(1u);
+
+    /* Format in place behind the previous records, the bytes are not copied again */
+    va_start(args, message);
+    va_copy(retry, args);
+    length = (size_t)Logging_FormatV(&batch_buffer[batch_fill], room, message, args);
+
+    if (length >= room)
+    {
+        /* Does not fit behind the others: send them, start the next batch with this one */
+        if (batch_fill > 0u)
+        {
+            batch_deliver();
+        }
+        length = logging_format_line(batch_buffer, sizeof(batch_buffer), message, retry);
+    }
+
+    va_end(retry);
+    va_end(args);
+
+    batch_append(length);
+
+    if (((level != LOG_NONE) && (level <= LOGGING_BATCH_FLUSH_LEVEL)) ||
+        ((LOGGING_BATCH_FLUSH_INTERVAL_MS > 0) && batch_due()))
+    {
+        batch_deliver();
+    }
+
+    LOGGING_ATOMIC_STORE_RELEASE(&batch_busy, 0u);
+    return (int)length;
+}
+
+void Logging_InitBatch(Logging_BatchFunction_t batch_func)
+{
+    if (batch_func)
+    {
+        batch_function = batch_func;
+        logging_set_sink(batch_entry);
+    }
+    else
+    {
+        Logging_Init(NULL);
+    }
+}
+
+int Logging_BatchWrite(const uint8_t *data, size_t length)
+{
+    if (length == 0u)
+    {
+        return 0;
+    }
+    if ((length > LOGGING_BATCH_BUFFER_SIZE) || (LOGGING_ATOMIC_EXCHANGE_ACQUIRE(&batch_busy, 1u) != 0u))
+    {
+        LOGGING_ATOMIC_FETCH_ADD_RELAXED(&batch_dropped, 1u);
+        return 0;
+    }
+
+    (void)batch_room(length);
+    memcpy(&batch_buffer[batch_fill], data, length);
+    batch_append(length);
+
+    if ((LOGGING_BATCH_FLUSH_INTERVAL_MS > 0) && batch_due())
+    {
+        batch_deliver();
+    }
+
+    LOGGING_ATOMIC_STORE_RELEASE(&batch_busy, 0u);
+    return (int)length;
+}
+
+void Logging_BatchFlush(void)
+{
+    if (LOGGING_ATOMIC_EXCHANGE_ACQUIRE(&batch_busy, 1u) != 0u)
+    {
+        return; /* The appending context delivers when the batch is full, or the next flush does */
+    }
+
+    batch_deliver();
+
+    LOGGING_ATOMIC_STORE_RELEASE(&batch_busy, 0u);
+}
+
+void logging_batch_poll(void)
+{
+    if (LOGGING_ATOMIC_EXCHANGE_ACQUIRE(&batch_busy, 1u) != 0u)
+    {
+        return;
+    }
+
+    if (batch_due())
+    {
+        batch_deliver();
+    }
+
+    LOGGING_ATOMIC_STORE_RELEASE(&batch_busy, 0u);
+}
+
+#ifdef LOGGING_PANIC
+void logging_batch_panic(Logging_WriteFunction_t write)
+{
+    /* Taken even from an interrupted context, its half-formatted record is not yet counted */
+    (void)LOGGING_ATOMIC_EXCHANGE_ACQUIRE(&batch_busy, 1u);
+
+    if (batch_count > 0u)
+    {
+        (void)write(batch_records[0].data, Logging_BatchLength(batch_records, batch_count));
+    }
+    batch_fill = 0u;
+    batch_count = 0u;
+
+    LOGGING_ATOMIC_STORE_RELEASE(&batch_busy, 0u);
+}
+#endif
+
+uint32_t Logging_GetBatchDropped(void)
+{
+    return LOGGING_ATOMIC_LOAD_RELAXED(&batch_dropped);
+}
+
+#endif /* LOGGING_BATCH */
@@ -0,0 +1,297 @@
+/**
+ * @file: logging_compress.c
+ * @author:: Paweł Kawula (pawel.kawula@kelectronics.pl)
+ * -----
+ * Copyright 2025 - KElectronics
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "logging.h"
+#include "logging_atomic.h"
+#include "logging_internal.h"
+
+#ifdef LOGGING_COMPRESS
+
+#if (LOGGING_COMPRESS_BLOCK_SIZE < 16) || (LOGGING_COMPRESS_BLOCK_SIZE > 32767)
+#error "LOGGING_COMPRESS_BLOCK_SIZE must be in range 16..32767."
+#endif
+
+#if (LOGGING_COMPRESS_WINDOW < 0) || ((LOGGING_COMPRESS_WINDOW + LOGGING_COMPRESS_BLOCK_SIZE) > 65534)
+#error "LOGGING_COMPRESS_WINDOW + LOGGING_COMPRESS_BLOCK_SIZE must not exceed 65534."
+#endif
+
+#if (LOGGING_COMPRESS_HASH_BITS < 8) || (LOGGING_COMPRESS_HASH_BITS > 16)
+#error "LOGGING_COMPRESS_HASH_BITS must be in range 8..16."
+#endif
+
+/* LZ4 block format limits */
+#define COMPRESS_MIN_MATCH 4u
+#define COMPRESS_LAST_LITERALS 5u  /* A block ends with at least this many literals */
+#define COMPRESS_MATCH_LIMIT 12u   /* No match starts closer than this to the block end */
+
+#define COMPRESS_HISTORY_SIZE (LOGGING_COMPRESS_WINDOW + LOGGING_COMPRESS_BLOCK_SIZE)
+
+/*
+ * Earlier blocks followed by the current one. Positions in the hash table
+ * are buffer offsets + 1, 0 marks an empty entry; the buffer slides down
+ * when the next block does not fit behind the window.
+ */
+static uint8_t compress_history[COMPRESS_HISTORY_SIZE];
+static uint16_t compress_table[1u << LOGGING_COMPRESS_HASH_BITS];
+static size_t compress_fill = 0;
+static size_t compress_start = 0; /* Oldest position matches may use */
+static uint8_t compress_block[LOGGING_COMPRESS_HEADER_SIZE + LOGGING_COMPRESS_BLOCK_SIZE];
+static uint8_t compress_busy = 0;
+static Logging_WriteFunction_t compress_output = NULL;
+static Logging_CompressStats_t compress_stats;
+
+static uint32_t compress_read32(const uint8_t *data)
+{
+    uint32_t value;
+    memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+static size_t compress_hash(uint32_t sequence)
+{
+    return (size_t)((sequence * 2654435761u) >> (32u - LOGGING_COMPRESS_HASH_BITS));
+}
+
+/* Keep the last LOGGING_COMPRESS_WINDOW bytes at the start of the buffer */
+static void compress_slide(void)
+{
+    size_t keep = compress_fill - compress_start;
+    size_t shift;
+    size_t i;
+
+    if (keep > LOGGING_COMPRESS_WINDOW)
+    {
+        keep = LOGGING_COMPRESS_WINDOW;
+    }
+    shift = compress_fill - keep;
+
+    memmove(compress_history, &compress_history[shift], keep);
+    compress_fill = keep;
+    compress_start = 0u;
+
+    for (i = 0; i < (sizeof(compress_table) / sizeof(compress_table[0])); i++)
+    {
+        compress_table[i] = (compress_table[i] > shift) ? (uint16_t)(compress_table[i] - shift) : 0u;
+    }
+}
+
+/* Length field continuation bytes of the LZ4 format */
+static size_t compress_put_length(uint8_t *out, size_t length)
+{
+    size_t written = 0;
+
+    while (length >= 255u)
+    {
+        out[written++] = 255u;
+        length -= 255u;
+    }
+    out[written++] = (uint8_t)length;
+    return written;
+}
+
+/*
+ * Append one sequence: literals, then a match (offset 0 for the final
+ * literals-only sequence). Returns the new output length, 0 when it would
+ * pass the limit - the block is then stored as is.
+ */
+static size_t compress_sequence(uint8_t *out, size_t written, size_t limit,
+                                const uint8_t *literals, size_t literal_length, size_t offset, size_t match_length)
+{
+    size_t worst = 1u + (literal_length / 255u) + 1u + literal_length + 2u + (match_length / 255u) + 1u;
+    size_t token = written++;
+    size_t extra = (offset != 0u) ? (match_length - COMPRESS_MIN_MATCH) : 0u;
+
+    if ((written + worst) > limit)
+    {
+        return 0u;
+    }
+
+    out[token] = (uint8_t)(((literal_length < 15u) ? literal_length : 15u) << 4);
+    if (literal_length >= 15u)
+    {
+        written += compress_put_length(&out[written], literal_length - 15u);
+    }
+    memcpy(&out[written], literals, literal_length);
+    written += literal_length;
+
+    if (offset != 0u)
+    {
+        out[token] |= (uint8_t)((extra < 15u) ? extra : 15u);
+        out[written++] = (uint8_t)offset;
+        out[written++] = (uint8_t)(offset >> 8);
+        if (extra >= 15u)
+        {
+            written += compress_put_length(&out[written], extra - 15u);
+        }
+    }
+
+    return written;
+}
+
+/* Greedy LZ4 parse of history[begin, end) into at most limit bytes, 0 when it does not fit */
+static size_t compress_lz4(size_t begin, size_t end, uint8_t *out, size_t limit)
+{
+    const uint8_t *base = compress_history;
+    size_t position = begin;
+    size_t anchor = begin;
+    size_t written = 0;
+
+    if ((end - begin) > COMPRESS_MATCH_LIMIT)
+    {
+        size_t match_limit = end - COMPRESS_MATCH_LIMIT;
+
+        while (position < match_limit)
+        {
+            uint32_t sequence = compress_read32(&base[position]);
+            size_t slot = compress_hash(sequence);
+            size_t candidate = compress_table[slot];
+            size_t length;
+
+            compress_table[slot] = (uint16_t)(position + 1u);
+
+            if ((candidate == 0u) || ((candidate - 1u) < compress_start) ||
+                ((position - (candidate - 1u)) > LOGGING_COMPRESS_WINDOW) ||
+                (compress_read32(&base[candidate - 1u]) != sequence))
+            {
+                position++;
+                continue;
+            }
+            candidate--;
+
+            length = COMPRESS_MIN_MATCH;
+            while (((position + length) < (end - COMPRESS_LAST_LITERALS)) &&
+                   (base[candidate + length] == base[position + length]))
+            {
+                length++;
+            }
+
+            written = compress_sequence(out, written, limit, &base[anchor], position - anchor,
+                                        position - candidate, length);
+            if (written == 0u)
+            {
+                return 0u;
+            }
+
+            position += length;
+            anchor = position;
+        }
+    }
+
+    /* Remember the tail too, later blocks may repeat it */
+    for (; (position + COMPRESS_MIN_MATCH) <= end; position++)
+    {
+        compress_table[compress_hash(compress_read32(&base[position]))] = (uint16_t)(position + 1u);
+    }
+
+    return compress_sequence(out, written, limit, &base[anchor], end - anchor, 0u, 0u);
+}
+
+/* Compress and write one block of at most LOGGING_COMPRESS_BLOCK_SIZE bytes, compress_busy held */
+static size_t compress_write_block(const uint8_t *data, size_t length)
+{
+    Logging_WriteFunction_t write = compress_output;
+    uint16_t header_length = (uint16_t)length;
+    size_t begin;
+    size_t stored;
+
+    if ((compress_fill + length) > COMPRESS_HISTORY_SIZE)
+    {
+        compress_slide();
+    }
+    if (compress_start == compress_fill)
+    {
+        header_length |= LOGGING_COMPRESS_RESTART; /* Decodable without the earlier blocks */
+    }
+
+    begin = compress_fill;
+    memcpy(&compress_history[begin], data, length);
+    compress_fill += length;
+
+    /* Must come out shorter, an equal length marks a block stored as is */
+    stored = compress_lz4(begin, compress_fill, &compress_block[LOGGING_COMPRESS_HEADER_SIZE], length - 1u);
+    if (stored == 0u)
+    {
+        memcpy(&compress_block[LOGGING_COMPRESS_HEADER_SIZE], data, length);
+        stored = length;
+    }
+
+    compress_block[0] = (uint8_t)header_length;
+    compress_block[1] = (uint8_t)(header_length >> 8);
+    compress_block[2] = (uint8_t)stored;
+    compress_block[3] = (uint8_t)(stored >> 8);
+    stored += LOGGING_COMPRESS_HEADER_SIZE;
+
+    LOGGING_ATOMIC_FETCH_ADD_RELAXED(&compress_stats.original, (uint32_t)length);
+    LOGGING_ATOMIC_FETCH_ADD_RELAXED(&compress_stats.written, (uint32_t)stored);
+
+    if (write != NULL)
+    {
+        (void)write(compress_block, stored);
+    }
+    return stored;
+}
+
+void Logging_InitCompress(Logging_WriteFunction_t write_func)
+{
+    compress_output = write_func;
+}
+
+int Logging_CompressWrite(const uint8_t *data, size_t length)
+{
+    size_t written = 0;
+
+    if (LOGGING_ATOMIC_EXCHANGE_ACQUIRE(&compress_busy, 1u) != 0u)
+    {
+        LOGGING_ATOMIC_FETCH_ADD_RELAXED(&compress_stats.dropped, 1u);
+        return 0;
+    }
+
+    while (length > 0u)
+    {
+        size_t block = (length < LOGGING_COMPRESS_BLOCK_SIZE) ? length : LOGGING_COMPRESS_BLOCK_SIZE;
+
+        written += compress_write_block(data, block);
+        data += block;
+        length -= block;
+    }
+
+    LOGGING_ATOMIC_STORE_RELEASE(&compress_busy, 0u);
+    return (int)written;
+}
+
+int Logging_CompressBatch(const Logging_Span_t *records, size_t count)
+{
+    return (count == 0u) ? 0 : Logging_CompressWrite(records[0].data, Logging_BatchLength(records, count));
+}
+
+void Logging_CompressReset(void)
+{
+    if (LOGGING_ATOMIC_EXCHANGE_ACQUIRE(&compress_busy, 1u) != 0u)
+    {
+        return;
+    }
+
+    compress_start = compress_fill;
+
+    LOGGING_ATOMIC_STORE_RELEASE(&compress_busy, 0u);
+}
+
+void Logging_GetCompressStats(Logging_CompressStats_t *stats)
+{
+    if (stats != NULL)
+    {
+        stats->original = LOGGING_ATOMIC_LOAD_RELAXED(&compress_stats.original);
+        stats->written = LOGGING_ATOMIC_LOAD_RELAXED(&compress_stats.written);
+        stats->dropped = LOGGING_ATOMIC_LOAD_RELAXED(&compress_stats.dropped);
+    }
+}
+
+#endif /* LOGGING_COMPRESS */
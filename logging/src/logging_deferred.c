@@ -0,0 +1,556 @@
+/**
+ * @file: logging_deferred.c
+ * @author:: Paweł Kawula (pawel.kawula@kelectronics.pl)
+ * -----
+ * Copyright 2025 - KElectronics
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "logging.h"
+#include "logging_atomic.h"
+#include "logging_internal.h"
+
+#ifdef LOGGING_DEFERRED
+
+#define DEFERRED_QUEUE_MASK ((size_t)LOGGING_DEFERRED_QUEUE_LEN - 1u)
+
+#if (LOGGING_DEFERRED_QUEUE_LEN < 2) || ((LOGGING_DEFERRED_QUEUE_LEN & (LOGGING_DEFERRED_QUEUE_LEN - 1)) != 0)
+#error "LOGGING_DEFERRED_QUEUE_LEN must be a power of two."
+#endif
+
+#if (LOGGING_DEFERRED_RESERVED < 0) || (LOGGING_DEFERRED_RESERVED >= LOGGING_DEFERRED_QUEUE_LEN)
+#error "LOGGING_DEFERRED_RESERVED must be in range 0..LOGGING_DEFERRED_QUEUE_LEN - 1."
+#endif
+
+/*
+ * After Logging_EnterPanic() the committing context drains the ring, the
+ * record is out before the macro returns. Producers on other cores and an
+ * interrupted drain task may then be consumers at the same time: a
+ * try-lock admits one, the others skip. The holder looks again after
+ * unlocking; with the fences on both sides either it sees a record
+ * committed meanwhile, or that producer finds the lock free.
+ */
+#ifdef LOGGING_PANIC
+static uint8_t deferred_draining = 0;
+
+#define DEFERRED_DRAIN_ENTER() (LOGGING_ATOMIC_EXCHANGE_ACQUIRE(&deferred_draining, 1u) == 0u)
+#define DEFERRED_DRAIN_LEAVE() LOGGING_ATOMIC_STORE_RELEASE(&deferred_draining, 0u)
+#define DEFERRED_DRAIN_AGAIN() deferred_drain_again()
+#define DEFERRED_PANIC_DRAIN()                                                    \
+    do                                                                            \
+    {                                                                             \
+        if (LOGGING_UNLIKELY(LOGGING_ATOMIC_LOAD_RELAXED(&logging_panic) != 0u)) \
+        {                                                                         \
+            LOGGING_ATOMIC_FENCE_SEQ_CST();                                       \
+            (void)Logging_DeferredProcess(0);                                     \
+        }                                                                         \
+    } while (0)
+
+static int deferred_drain_again(void)
+{
+    if (LOGGING_ATOMIC_LOAD_RELAXED(&logging_panic) == 0u)
+    {
+        return 0;
+    }
+    LOGGING_ATOMIC_FENCE_SEQ_CST();
+    return Logging_DeferredPending() > 0u;
+}
+#else
+#define DEFERRED_DRAIN_ENTER() 1
+#define DEFERRED_DRAIN_LEAVE() ((void)0)
+#define DEFERRED_DRAIN_AGAIN() 0
+#define DEFERRED_PANIC_DRAIN() ((void)0)
+#endif
+
+#if LOGGING_DEFERRED_OVERFLOW != LOGGING_OVERFLOW_OVERWRITE
+
+/* Ring fill level at which a record of this level finds no room */
+static size_t deferred_limit(uint8_t level)
+{
+    return (level == LOG_ERROR) ? LOGGING_DEFERRED_QUEUE_LEN
+                                : (LOGGING_DEFERRED_QUEUE_LEN - LOGGING_DEFERRED_RESERVED);
+}
+
+typedef struct
+{
+    uint32_t start;
+    int waiting;
+} Deferred_Wait_t;
+
+/* Called each time a producer finds no room: 1 to look again, 0 to drop the record */
+static int deferred_wait(Deferred_Wait_t *wait)
+{
+#if LOGGING_DEFERRED_OVERFLOW == LOGGING_OVERFLOW_BLOCK
+    uint32_t now = (uint32_t)LOGGING_DEFERRED_CLOCK();
+
+    if (!wait->waiting)
+    {
+        wait->waiting = 1;
+        wait->start = now;
+    }
+    else if ((uint32_t)(now - wait->start) >= (uint32_t)LOGGING_DEFERRED_BLOCK_TIMEOUT_MS)
+    {
+        return 0;
+    }
+
+    LOGGING_DEFERRED_WAIT();
+    return 1;
+#else
+    (void)wait;
+    return 0;
+#endif
+}
+
+#endif /* LOGGING_DEFERRED_OVERFLOW != LOGGING_OVERFLOW_OVERWRITE */
+
+/* Dropped counter value already reported in-band, drain owned */
+static uint32_t deferred_reported = 0;
+
+/* Called by the drain once the ring is empty: tell the output how many messages it missed */
+static void deferred_report(Logging_Function_t sink)
+{
+    const char *notice = LOGGING_DEFERRED_DROPPED_MESSAGE;
+    uint32_t dropped = Logging_DeferredDropped();
+
+    if ((notice != NULL) && (dropped != deferred_reported))
+    {
+        (void)sink(notice, (unsigned long)(dropped - deferred_reported));
+        deferred_reported = dropped;
+    }
+}
+
+#ifdef LOGGING_DEFERRED_PER_CORE
+
+#if (LOGGING_DEFERRED_CORES < 1) || (LOGGING_DEFERRED_CORES > 64)
+#error "LOGGING_DEFERRED_CORES must be in range 1..64."
+#endif
+
+/*
+ * One single-producer ring per core: head is written only by its core, tail
+ * only by the drain. Producers use plain loads and stores with acquire/release
+ * ordering - no read-modify-write, no shared cache lines between cores.
+ */
+typedef struct
+{
+    Logging_DeferredRecord_t queue[LOGGING_DEFERRED_QUEUE_LEN];
+    size_t head;      /* Next position to be written, producer owned */
+    uint32_t dropped; /* Producer owned */
+    size_t tail __attribute__((aligned(64))); /* Next position to be processed, consumer owned */
+} __attribute__((aligned(64))) Deferred_Ring_t;
+
+static Deferred_Ring_t deferred_rings[LOGGING_DEFERRED_CORES];
+
+Logging_DeferredRecord_t *Logging_DeferredAcquire(uint8_t level)
+{
+    unsigned core = (unsigned)LOGGING_DEFERRED_CORE_ID();
+    Deferred_Wait_t wait = { 0u, 0 };
+    size_t limit = deferred_limit(level);
+    Deferred_Ring_t *ring;
+    size_t head;
+
+    if (core >= LOGGING_DEFERRED_CORES)
+    {
+        return NULL; /* Misconfigured core index */
+    }
+
+    ring = &deferred_rings[core];
+    head = LOGGING_ATOMIC_LOAD_RELAXED(&ring->head);
+
+    while ((head - LOGGING_ATOMIC_LOAD_ACQUIRE(&ring->tail)) >= limit)
+    {
+        if (!deferred_wait(&wait))
+        {
+            LOGGING_ATOMIC_STORE_RELAXED(&ring->dropped, LOGGING_ATOMIC_LOAD_RELAXED(&ring->dropped) + 1u);
+            return NULL;
+        }
+    }
+
+    return &ring->queue[head & DEFERRED_QUEUE_MASK];
+}
+
+void Logging_DeferredCommit(Logging_DeferredRecord_t *record)
+{
+    /* The record address identifies the ring, the core index is not read twice */
+    Deferred_Ring_t *ring = &deferred_rings[((uintptr_t)record - (uintptr_t)deferred_rings) / sizeof(Deferred_Ring_t)];
+
+    LOGGING_ATOMIC_STORE_RELEASE(&ring->head, LOGGING_ATOMIC_LOAD_RELAXED(&ring->head) + 1u);
+    DEFERRED_PANIC_DRAIN();
+}
+
+/* Timestamp of the call site, always the first captured argument */
+static Logging_Timestamp_t deferred_timestamp(const Logging_DeferredRecord_t *record)
+{
+    return (Logging_Timestamp_t)record->args[0];
+}
+
+/* Wrap-around aware "a was taken before b" */
+static int deferred_before(Logging_Timestamp_t a, Logging_Timestamp_t b)
+{
+    return (Logging_Timestamp_t)(a - b) > (Logging_Timestamp_t)(((Logging_Timestamp_t)~(Logging_Timestamp_t)0) / 2u);
+}
+
+/* One drain pass, up to max_records (0: until empty) */
+static size_t deferred_drain(Logging_Function_t sink, size_t max_records)
+{
+    size_t processed = 0;
+
+    while ((max_records == 0u) || (processed < max_records))
+    {
+        const Logging_DeferredRecord_t *oldest = NULL;
+        Deferred_Ring_t *oldest_ring = NULL;
+        size_t oldest_position = 0;
+        unsigned core;
+
+        /* Merge: the oldest head record of all rings goes first */
+        for (core = 0; core < LOGGING_DEFERRED_CORES; core++)
+        {
+            Deferred_Ring_t *ring = &deferred_rings[core];
+            size_t position = LOGGING_ATOMIC_LOAD_RELAXED(&ring->tail);
+            const Logging_DeferredRecord_t *record;
+
+            if (position == LOGGING_ATOMIC_LOAD_ACQUIRE(&ring->head))
+            {
+                continue;
+            }
+
+            record = &ring->queue[position & DEFERRED_QUEUE_MASK];
+            if ((oldest == NULL) || deferred_before(deferred_timestamp(record), deferred_timestamp(oldest)))
+            {
+                oldest = record;
+                oldest_ring = ring;
+                oldest_position = position;
+            }
+        }
+
+        if (oldest == NULL)
+        {
+            deferred_report(sink);
+            break;
+        }
+
+        (void)sink(oldest->format,
+                   oldest->args[0], oldest->args[1], oldest->args[2], oldest->args[3],
+                   oldest->args[4], oldest->args[5], oldest->args[6], oldest->args[7]);
+
+        LOGGING_ATOMIC_STORE_RELEASE(&oldest_ring->tail, oldest_position + 1u);
+        processed++;
+    }
+
+    return processed;
+}
+
+size_t Logging_DeferredPending(void)
+{
+    size_t pending = 0;
+    unsigned core;
+
+    for (core = 0; core < LOGGING_DEFERRED_CORES; core++)
+    {
+        pending += LOGGING_ATOMIC_LOAD_ACQUIRE(&deferred_rings[core].head) -
+                   LOGGING_ATOMIC_LOAD_RELAXED(&deferred_rings[core].tail);
+    }
+
+    return pending;
+}
+
+uint32_t Logging_DeferredDropped(void)
+{
+    uint32_t dropped = 0;
+    unsigned core;
+
+    for (core = 0; core < LOGGING_DEFERRED_CORES; core++)
+    {
+        dropped += LOGGING_ATOMIC_LOAD_RELAXED(&deferred_rings[core].dropped);
+    }
+
+    return dropped;
+}
+
+#else /* Shared ring */
+
+/*
+ * Positions are free-running counters, a slot index is (position & mask).
+ * Only one context may drain the queue (Logging_Flush / Logging_DeferredProcess).
+ */
+static size_t deferred_tail = 0; /* Next position to be processed, consumer owned */
+static uint32_t deferred_dropped = 0;
+
+#ifdef LOGGING_DEFERRED_MPSC
+
+/*
+ * Multi-producer variant (bounded MPMC queue restricted to one consumer).
+ * Producers reserve a position with CAS and publish it through the slot
+ * sequence. The sequence is stored relative to the slot index so that the
+ * zero-initialized queue is valid without an init call:
+ *     actual sequence = slot.sequence + index
+ */
+typedef struct
+{
+    Logging_DeferredRecord_t record; /* Must stay first, see Logging_DeferredCommit */
+    size_t sequence;
+} Deferred_Slot_t;
+
+static Deferred_Slot_t deferred_queue[LOGGING_DEFERRED_QUEUE_LEN];
+static size_t deferred_head = 0; /* Next position to be reserved */
+
+Logging_DeferredRecord_t *Logging_DeferredAcquire(uint8_t level)
+{
+    Deferred_Wait_t wait = { 0u, 0 };
+    size_t limit = deferred_limit(level);
+    size_t position = LOGGING_ATOMIC_LOAD_RELAXED(&deferred_head);
+
+    for (;;)
+    {
+        size_t index = position & DEFERRED_QUEUE_MASK;
+        Deferred_Slot_t *slot = &deferred_queue[index];
+        size_t sequence = LOGGING_ATOMIC_LOAD_ACQUIRE(&slot->sequence) + index;
+        /* Slot free but only the reserve left, or slot still holds a record from the previous lap */
+        int full = (sequence == position)
+                       ? ((limit < LOGGING_DEFERRED_QUEUE_LEN) &&
+                          ((intptr_t)(position - LOGGING_ATOMIC_LOAD_RELAXED(&deferred_tail)) >= (intptr_t)limit))
+                       : ((intptr_t)(sequence - position) < 0);
+
+        if (full)
+        {
+            if (!deferred_wait(&wait))
+            {
+                LOGGING_ATOMIC_FETCH_ADD_RELAXED(&deferred_dropped, 1u);
+                return NULL;
+            }
+            position = LOGGING_ATOMIC_LOAD_RELAXED(&deferred_head);
+        }
+        else if (sequence == position)
+        {
+            if (LOGGING_ATOMIC_CAS_WEAK(&deferred_head, &position, position + 1u))
+            {
+                return &slot->record;
+            }
+        }
+        else
+        {
+            position = LOGGING_ATOMIC_LOAD_RELAXED(&deferred_head);
+        }
+    }
+}
+
+void Logging_DeferredCommit(Logging_DeferredRecord_t *record)
+{
+    Deferred_Slot_t *slot = (Deferred_Slot_t *)record;
+    size_t index = (size_t)(slot - deferred_queue);
+
+    /* Reserved slot is owned by this producer: its sequence equals the reserved position */
+    size_t position = LOGGING_ATOMIC_LOAD_RELAXED(&slot->sequence) + index;
+    LOGGING_ATOMIC_STORE_RELEASE(&slot->sequence, position + 1u - index);
+    DEFERRED_PANIC_DRAIN();
+}
+
+static const Logging_DeferredRecord_t *deferred_peek(size_t position)
+{
+    size_t index = position & DEFERRED_QUEUE_MASK;
+    Deferred_Slot_t *slot = &deferred_queue[index];
+
+    if ((LOGGING_ATOMIC_LOAD_ACQUIRE(&slot->sequence) + index) != (position + 1u))
+    {
+        return NULL; /* Empty or reserved but not yet committed */
+    }
+    return &slot->record;
+}
+
+static void deferred_release(size_t position)
+{
+    size_t index = position & DEFERRED_QUEUE_MASK;
+
+    LOGGING_ATOMIC_STORE_RELEASE(&deferred_queue[index].sequence,
+                                 position + LOGGING_DEFERRED_QUEUE_LEN - index);
+    LOGGING_ATOMIC_STORE_RELAXED(&deferred_tail, position + 1u);
+}
+
+#else
+
+/*
+ * Single-producer fast path: head is written only by the producer, tail only
+ * by the consumer, no read-modify-write operations needed.
+ */
+static Logging_DeferredRecord_t deferred_queue[LOGGING_DEFERRED_QUEUE_LEN];
+static size_t deferred_head = 0; /* Next position to be written, producer owned */
+
+Logging_DeferredRecord_t *Logging_DeferredAcquire(uint8_t level)
+{
+    size_t head = LOGGING_ATOMIC_LOAD_RELAXED(&deferred_head);
+    size_t tail = LOGGING_ATOMIC_LOAD_ACQUIRE(&deferred_tail);
+#if LOGGING_DEFERRED_OVERFLOW == LOGGING_OVERFLOW_OVERWRITE
+    (void)level;
+
+    /* Take the oldest record away from the drain; if the drain claims it first the slot is free anyway */
+    while ((head - tail) >= LOGGING_DEFERRED_QUEUE_LEN)
+    {
+        if (LOGGING_ATOMIC_CAS_WEAK(&deferred_tail, &tail, tail + 1u))
+        {
+            LOGGING_ATOMIC_STORE_RELAXED(&deferred_dropped, LOGGING_ATOMIC_LOAD_RELAXED(&deferred_dropped) + 1u);
+            break;
+        }
+        tail = LOGGING_ATOMIC_LOAD_ACQUIRE(&deferred_tail);
+    }
+#else
+    Deferred_Wait_t wait = { 0u, 0 };
+    size_t limit = deferred_limit(level);
+
+    while ((head - tail) >= limit)
+    {
+        if (!deferred_wait(&wait))
+        {
+            LOGGING_ATOMIC_STORE_RELAXED(&deferred_dropped, LOGGING_ATOMIC_LOAD_RELAXED(&deferred_dropped) + 1u);
+            return NULL;
+        }
+        tail = LOGGING_ATOMIC_LOAD_ACQUIRE(&deferred_tail);
+    }
+#endif
+
+    return &deferred_queue[head & DEFERRED_QUEUE_MASK];
+}
+
+void Logging_DeferredCommit(Logging_DeferredRecord_t *record)
+{
+    (void)record;
+    LOGGING_ATOMIC_STORE_RELEASE(&deferred_head, LOGGING_ATOMIC_LOAD_RELAXED(&deferred_head) + 1u);
+    DEFERRED_PANIC_DRAIN();
+}
+
+static const Logging_DeferredRecord_t *deferred_peek(size_t position)
+{
+    if (position == LOGGING_ATOMIC_LOAD_ACQUIRE(&deferred_head))
+    {
+        return NULL;
+    }
+    return &deferred_queue[position & DEFERRED_QUEUE_MASK];
+}
+
+#if LOGGING_DEFERRED_OVERFLOW == LOGGING_OVERFLOW_OVERWRITE
+/* Tail is shared with the producer, which moves it when overwriting: 0 when the record was taken over */
+static int deferred_claim(size_t position)
+{
+    size_t expected = position;
+
+    while (!LOGGING_ATOMIC_CAS_WEAK(&deferred_tail, &expected, position + 1u))
+    {
+        if (expected != position)
+        {
+            return 0;
+        }
+    }
+    return 1;
+}
+#else
+static void deferred_release(size_t position)
+{
+    LOGGING_ATOMIC_STORE_RELEASE(&deferred_tail, position + 1u);
+}
+#endif
+
+#endif /* LOGGING_DEFERRED_MPSC */
+
+/* One drain pass, up to max_records (0: until empty) */
+static size_t deferred_drain(Logging_Function_t sink, size_t max_records)
+{
+    size_t processed = 0;
+    size_t position = LOGGING_ATOMIC_LOAD_RELAXED(&deferred_tail);
+    const Logging_DeferredRecord_t *record = NULL;
+#if LOGGING_DEFERRED_OVERFLOW == LOGGING_OVERFLOW_OVERWRITE
+    Logging_DeferredRecord_t copy;
+#endif
+
+    while (((max_records == 0u) || (processed < max_records)) &&
+           ((record = deferred_peek(position)) != NULL))
+    {
+#if LOGGING_DEFERRED_OVERFLOW == LOGGING_OVERFLOW_OVERWRITE
+        /* The producer may overwrite the slot at any time: copy first, keep the copy only if still ours */
+        copy = *record;
+        if (!deferred_claim(position))
+        {
+            position = LOGGING_ATOMIC_LOAD_ACQUIRE(&deferred_tail);
+            continue;
+        }
+        record = &copy;
+#endif
+
+        /* Unused trailing words are ignored by printf-style sinks */
+        (void)sink(record->format,
+                   record->args[0], record->args[1], record->args[2], record->args[3],
+                   record->args[4], record->args[5], record->args[6], record->args[7]);
+
+#if LOGGING_DEFERRED_OVERFLOW != LOGGING_OVERFLOW_OVERWRITE
+        deferred_release(position);
+#endif
+        position++;
+        processed++;
+    }
+
+    if (record == NULL)
+    {
+        deferred_report(sink);
+    }
+
+    return processed;
+}
+
+size_t Logging_DeferredPending(void)
+{
+    return LOGGING_ATOMIC_LOAD_ACQUIRE(&deferred_head) - LOGGING_ATOMIC_LOAD_RELAXED(&deferred_tail);
+}
+
+uint32_t Logging_DeferredDropped(void)
+{
+    return LOGGING_ATOMIC_LOAD_RELAXED(&deferred_dropped);
+}
+
+#endif /* LOGGING_DEFERRED_PER_CORE */
+
+size_t Logging_DeferredProcess(size_t max_records)
+{
+    size_t processed = 0;
+    Logging_Function_t sink = LOGGING_CURRENT_SINK();
+
+    /* Keep the records until a real output is registered */
+    if (sink == logging_default_log_function)
+    {
+        return 0;
+    }
+
+    while (DEFERRED_DRAIN_ENTER())
+    {
+        processed += deferred_drain(sink, (max_records == 0u) ? 0u : (max_records - processed));
+        DEFERRED_DRAIN_LEAVE();
+
+        if (((max_records != 0u) && (processed >= max_records)) || !DEFERRED_DRAIN_AGAIN())
+        {
+            break;
+        }
+    }
+
+#ifdef LOGGING_BATCH
+    logging_batch_poll(); /* A drain pass ends with its records sent */
+#endif
+    return processed;
+}
+
+#ifdef LOGGING_PANIC
+void logging_deferred_panic(void)
+{
+    /* Taken over even from an interrupted drain, it does not resume before the reset */
+    DEFERRED_DRAIN_LEAVE();
+    (void)Logging_DeferredProcess(0);
+}
+#endif
+
+#endif /* LOGGING_DEFERRED */
+
+void Logging_Flush(void)
+{
+#ifdef LOGGING_DEFERRED
+    (void)Logging_DeferredProcess(0);
+#elif defined(LOGGING_BATCH)
+    logging_batch_poll();
+#endif
+}
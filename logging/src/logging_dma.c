@@ -0,0 +1,169 @@
+/**
+ * @file: logging_dma.c
+ * @author:: Paweł Kawula (pawel.kawula@kelectronics.pl)
+ * -----
+ * Copyright 2025 - KElectronics
+ */
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "logging.h"
+#include "logging_atomic.h"
+#include "logging_internal.h"
+
+#ifdef LOGGING_DMA
+
+#if LOGGING_DMA_BUFFER_SIZE < 4
+#error "LOGGING_DMA_BUFFER_SIZE must be at least 4."
+#endif
+
+#ifdef LOGGING_DMA_BUFFER_SECTION
+#define DMA_BUFFER_ATTRIBUTES __attribute__((aligned(4), section(LOGGING_DMA_BUFFER_SECTION)))
+#else
+#define DMA_BUFFER_ATTRIBUTES __attribute__((aligned(4)))
+#endif
+
+static char dma_buffer[2][LOGGING_DMA_BUFFER_SIZE] DMA_BUFFER_ATTRIBUTES;
+static size_t dma_fill[2];
+static uint8_t dma_active = 0;      /* Half being filled */
+static uint8_t dma_append_busy = 0; /* Held while a half is appended to or swapped */
+static uint8_t dma_in_flight = 0;   /* Set from transfer start until Logging_DmaComplete() */
+static uint32_t dma_dropped = 0;
+static Logging_DmaStartFunction_t dma_start = NULL;
+
+/*
+ * Start the next transfer if none is running and data is waiting. Whoever
+ * sets dma_in_flight owns the start; if an append is in progress it gives up
+ * and the appending context retries after releasing the half.
+ */
+static void dma_try_start(void)
+{
+    Logging_DmaStartFunction_t start;
+    uint8_t half;
+    size_t length;
+
+    if (LOGGING_ATOMIC_EXCHANGE_ACQUIRE(&dma_in_flight, 1u) != 0u)
+    {
+        return; /* Transfer running, its completion starts the next one */
+    }
+
+    if (LOGGING_ATOMIC_EXCHANGE_ACQUIRE(&dma_append_busy, 1u) != 0u)
+    {
+        LOGGING_ATOMIC_STORE_RELEASE(&dma_in_flight, 0u);
+        return;
+    }
+
+    half = dma_active;
+    length = dma_fill[half];
+    start = dma_start;
+
+    if ((length == 0u) || (start == NULL))
+    {
+        LOGGING_ATOMIC_STORE_RELEASE(&dma_append_busy, 0u);
+        LOGGING_ATOMIC_STORE_RELEASE(&dma_in_flight, 0u);
+        return;
+    }
+
+    /* The other half was transmitted by the previous transfer */
+    dma_active = (uint8_t)(half ^ 1u);
+    dma_fill[dma_active] = 0u;
+    LOGGING_ATOMIC_STORE_RELEASE(&dma_append_busy, 0u);
+
+    start((const uint8_t *)dma_buffer[half], length);
+}
+
+/* Installed as log_function by Logging_InitDma() */
+static int dma_entry(const char *message, ...)
+{
+    char *line;
+    size_t room;
+    size_t length;
+    va_list args;
+
+    if (LOGGING_ATOMIC_EXCHANGE_ACQUIRE(&dma_append_busy, 1u) != 0u)
+    {
+        LOGGING_ATOMIC_FETCH_ADD_RELAXED(&dma_dropped, 1u);
+        return -1;
+    }
+
+    /* Format in place, the bytes are not copied again */
+    line = &dma_buffer[dma_active][dma_fill[dma_active]];
+    room = LOGGING_DMA_BUFFER_SIZE - dma_fill[dma_active];
+
+    va_start(args, message);
+    length = (size_t)Logging_FormatV(line, room, message, args);
+    va_end(args);
+
+    if (length < room)
+    {
+        dma_fill[dma_active] += length;
+    }
+    else if (dma_fill[dma_active] == 0u)
+    {
+        /* Longer than a whole half - truncate, keep the line ending */
+        length = room - 1u;
+        line[length - 2u] = '\r';
+        line[length - 1u] = '\n';
+        dma_fill[dma_active] = length;
+    }
+    else
+    {
+        LOGGING_ATOMIC_FETCH_ADD_RELAXED(&dma_dropped, 1u);
+        length = 0u;
+    }
+
+    LOGGING_ATOMIC_STORE_RELEASE(&dma_append_busy, 0u);
+
+    dma_try_start();
+    return (length > 0u) ? (int)length : -1;
+}
+
+void Logging_InitDma(Logging_DmaStartFunction_t start_func)
+{
+    if (start_func)
+    {
+        dma_start = start_func;
+        logging_set_sink(dma_entry);
+    }
+    else
+    {
+        Logging_Init(NULL);
+    }
+}
+
+void Logging_DmaComplete(void)
+{
+    LOGGING_ATOMIC_STORE_RELEASE(&dma_in_flight, 0u);
+    dma_try_start();
+}
+
+#ifdef LOGGING_PANIC
+void logging_dma_panic(Logging_WriteFunction_t write)
+{
+    uint8_t half;
+
+    dma_start = NULL; /* A completion no longer starts the next half */
+
+    /* Taken even from an interrupted append, its half-formatted line is not yet counted */
+    (void)LOGGING_ATOMIC_EXCHANGE_ACQUIRE(&dma_append_busy, 1u);
+
+    /* The half in flight is left to the running transfer */
+    half = dma_active;
+    if (dma_fill[half] > 0u)
+    {
+        (void)write((const uint8_t *)dma_buffer[half], dma_fill[half]);
+        dma_fill[half] = 0u;
+    }
+
+    LOGGING_ATOMIC_STORE_RELEASE(&dma_append_busy, 0u);
+}
+#endif
+
+uint32_t Logging_GetDmaDropped(void)
+{
+    return LOGGING_ATOMIC_LOAD_RELAXED(&dma_dropped);
+}
+
+#endif /* LOGGING_DMA */
@@ -0,0 +1,79 @@
+/**
+ * @file: logging_filter.c
+ * @author:: Paweł Kawula (pawel.kawula@kelectronics.pl)
+ * -----
+ * Copyright 2025 - KElectronics
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "logging.h"
+#include "logging_levels.h"
+
+#ifdef LOGGING_RUNTIME_FILTER
+
+volatile uint8_t logging_unnamed_level = LOGGING_RUNTIME_DEFAULT_LEVEL;
+
+/* Built by constructors before main(), read-only afterwards */
+static Logging_Module_t *module_list = NULL;
+
+void Logging_RegisterModule(Logging_Module_t *module)
+{
+    if (module)
+    {
+        module->next = module_list;
+        module_list = module;
+    }
+}
+
+int Logging_SetModuleLevel(const char *name, int level)
+{
+    int updated = 0;
+    Logging_Module_t *module;
+
+    if ((level < LOG_NONE) || (level > LOG_DEBUG))
+    {
+        return -1;
+    }
+
+    if ((name == NULL) || (name[0] == '\0'))
+    {
+        logging_unnamed_level = (uint8_t)level;
+        updated++;
+    }
+
+    for (module = module_list; module != NULL; module = module->next)
+    {
+        if ((name == NULL) || (strcmp(module->name, name) == 0))
+        {
+            *module->level = (uint8_t)level;
+            updated++;
+        }
+    }
+
+    return updated;
+}
+
+int Logging_GetModuleLevel(const char *name)
+{
+    const Logging_Module_t *module;
+
+    if ((name == NULL) || (name[0] == '\0'))
+    {
+        return logging_unnamed_level;
+    }
+
+    for (module = module_list; module != NULL; module = module->next)
+    {
+        if (strcmp(module->name, name) == 0)
+        {
+            return *module->level;
+        }
+    }
+
+    return -1;
+}
+
+#endif /* LOGGING_RUNTIME_FILTER */
@@ -0,0 +1,581 @@
+/**
+ * @file: logging_format.c
+ * @author:: Paweł Kawula (pawel.kawula@kelectronics.pl)
+ * -----
+ * Copyright 2025 - KElectronics
+ */
+
+#include <limits.h>
+#include <math.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "logging.h"
+
+/* Digits of the widest value: 20 integer digits + '.' + fraction */
+#define FORMAT_DIGITS_SIZE 32u
+
+typedef struct
+{
+    char *buffer;
+    size_t size;
+    size_t length; /* Characters produced, including those that did not fit */
+} Format_Out_t;
+
+typedef enum
+{
+    FORMAT_LENGTH_NONE,
+    FORMAT_LENGTH_HH,
+    FORMAT_LENGTH_H,
+    FORMAT_LENGTH_L,
+    FORMAT_LENGTH_LL,
+    FORMAT_LENGTH_J,
+    FORMAT_LENGTH_Z,
+    FORMAT_LENGTH_T,
+    FORMAT_LENGTH_BIG_L /* long double */
+} Format_Length_t;
+
+typedef struct
+{
+    uint8_t left;
+    uint8_t zero;
+    uint8_t plus;
+    uint8_t space;
+    uint8_t alternate;
+    size_t width;
+    int precision; /* -1 when not given */
+    Format_Length_t length;
+} Format_Spec_t;
+
+static void out_char(Format_Out_t *out, char c)
+{
+    if ((out->length + 1u) < out->size)
+    {
+        out->buffer[out->length] = c;
+    }
+    out->length++;
+}
+
+static void out_repeat(Format_Out_t *out, char c, size_t count)
+{
+    size_t room = (out->length + 1u < out->size) ? (out->size - 1u - out->length) : 0u;
+
+    if (room > 0u)
+    {
+        memset(&out->buffer[out->length], c, (count < room) ? count : room);
+    }
+    out->length += count;
+}
+
+static void out_chars(Format_Out_t *out, const char *chars, size_t count)
+{
+    size_t room = (out->length + 1u < out->size) ? (out->size - 1u - out->length) : 0u;
+
+    if (room > 0u)
+    {
+        memcpy(&out->buffer[out->length], chars, (count < room) ? count : room);
+    }
+    out->length += count;
+}
+
+/* prefix | zero padding | leading zeros | digits, padded with spaces to the field width */
+static void out_field(Format_Out_t *out, const Format_Spec_t *spec, const char *prefix, size_t prefix_length,
+                      const char *digits, size_t digit_count, size_t zeros)
+{
+    size_t total = prefix_length + zeros + digit_count;
+    size_t pad = (spec->width > total) ? (spec->width - total) : 0u;
+
+    if (!spec->left && !spec->zero)
+    {
+        out_repeat(out, ' ', pad);
+    }
+    out_chars(out, prefix, prefix_length);
+    if (!spec->left && spec->zero)
+    {
+        out_repeat(out, '0', pad);
+    }
+    out_repeat(out, '0', zeros);
+    out_chars(out, digits, digit_count);
+    if (spec->left)
+    {
+        out_repeat(out, ' ', pad);
+    }
+}
+
+/* Digits of value written backwards from the end of digits, returns the count */
+static size_t format_digits(char *end, unsigned long long value, unsigned base, int upper)
+{
+    const char *symbols = upper ? "0123456789ABCDEF" : "0123456789abcdef";
+    size_t count = 0;
+
+    do
+    {
+        *--end = symbols[value % base];
+        value /= base;
+        count++;
+    } while (value != 0u);
+
+    return count;
+}
+
+static void format_integer(Format_Out_t *out, const Format_Spec_t *spec, unsigned long long value,
+                           int negative, unsigned base, int upper, const char *base_prefix)
+{
+    char digits[FORMAT_DIGITS_SIZE];
+    char prefix[4] = { 0 };
+    size_t prefix_length = 0;
+    size_t count;
+    size_t zeros = 0;
+    Format_Spec_t field = *spec;
+
+    if (negative)
+    {
+        prefix[prefix_length++] = '-';
+    }
+    else if (spec->plus)
+    {
+        prefix[prefix_length++] = '+';
+    }
+    else if (spec->space)
+    {
+        prefix[prefix_length++] = ' ';
+    }
+
+    if (base_prefix != NULL)
+    {
+        prefix[prefix_length++] = base_prefix[0];
+        prefix[prefix_length++] = base_prefix[1];
+    }
+
+    if ((spec->precision == 0) && (value == 0u))
+    {
+        count = 0; /* "%.0d" of 0 prints no digits */
+    }
+    else
+    {
+        count = format_digits(&digits[sizeof(digits)], value, base, upper);
+    }
+
+    if (spec->precision >= 0)
+    {
+        field.zero = 0;
+        if ((size_t)spec->precision > count)
+        {
+            zeros = (size_t)spec->precision - count;
+        }
+    }
+
+    out_field(out, &field, prefix, prefix_length, &digits[sizeof(digits) - count], count, zeros);
+}
+
+/* word * 10 + carry in 32-bit halves: keeps the low 64 bits, returns what moved above them */
+static unsigned fraction_times_ten(uint64_t *word, unsigned carry)
+{
+    uint64_t low = ((*word & 0xFFFFFFFFu) * 10u) + carry;
+    uint64_t high = ((*word >> 32) * 10u) + (low >> 32);
+
+    *word = (high << 32) | (low & 0xFFFFFFFFu);
+    return (unsigned)(high >> 32);
+}
+
+static void format_double(Format_Out_t *out, const Format_Spec_t *spec, double value, int upper)
+{
+    char digits[FORMAT_DIGITS_SIZE];
+    char *end = &digits[sizeof(digits)];
+    char *fraction_digits;
+    char sign = 0;
+    int precision = (spec->precision < 0) ? 6 : spec->precision;
+    int i;
+    size_t count = 0;
+    unsigned long long integer;
+    uint64_t fraction[2]; /* Bits 2^-1 ... 2^-64, then 2^-65 ... 2^-128 */
+    uint64_t half = (uint64_t)1u << 63;
+    double scaled;
+    int inexact;
+    int above_half;
+    Format_Spec_t field = *spec;
+
+    if (precision > 9)
+    {
+        precision = 9;
+    }
+
+    if (signbit(value))
+    {
+        sign = '-';
+        value = -value;
+    }
+    else if (spec->plus)
+    {
+        sign = '+';
+    }
+    else if (spec->space)
+    {
+        sign = ' ';
+    }
+
+    if (value != value)
+    {
+        field.zero = 0;
+        out_field(out, &field, &sign, (sign != 0) ? 1u : 0u, upper ? "NAN" : "nan", 3u, 0u);
+        return;
+    }
+    if (value >= 18446744073709551616.0) /* Infinity or beyond the integer part range */
+    {
+        field.zero = 0;
+        out_field(out, &field, &sign, (sign != 0) ? 1u : 0u, upper ? "INF" : "inf", 3u, 0u);
+        return;
+    }
+
+    /*
+     * Split without rounding: the integer part has no more significant bits
+     * than value, and scaling by 2^64 only moves the exponent. 128 fraction
+     * bits hold every value from 2^-75 up exactly; below that, where nine
+     * digits stay far from a tie, the lost bits only mark the remainder.
+     */
+    integer = (unsigned long long)value;
+    scaled = (value - (double)integer) * 18446744073709551616.0;
+    fraction[0] = (uint64_t)scaled;
+    scaled = (scaled - (double)fraction[0]) * 18446744073709551616.0;
+    fraction[1] = (uint64_t)scaled;
+    inexact = (scaled != (double)fraction[1]);
+
+    fraction_digits = end - precision;
+    for (i = 0; i < precision; i++)
+    {
+        fraction_digits[i] = (char)('0' + fraction_times_ten(&fraction[0], fraction_times_ten(&fraction[1], 0u)));
+    }
+
+    /* Round half to even on the exact remainder, like printf */
+    above_half = (fraction[0] > half) || ((fraction[0] == half) && ((fraction[1] != 0u) || inexact));
+    if (above_half ||
+        ((fraction[0] == half) &&
+         ((((precision > 0) ? (unsigned)(fraction_digits[precision - 1] - '0') : (unsigned)integer) & 1u) != 0u)))
+    {
+        for (i = precision - 1; (i >= 0) && (fraction_digits[i] == '9'); i--)
+        {
+            fraction_digits[i] = '0';
+        }
+        if (i >= 0)
+        {
+            fraction_digits[i]++;
+        }
+        else
+        {
+            integer++;
+        }
+    }
+
+    end = fraction_digits;
+    count += (size_t)precision;
+    if ((precision > 0) || spec->alternate)
+    {
+        *--end = '.';
+        count++;
+    }
+    count += format_digits(end, integer, 10u, 0);
+
+    out_field(out, &field, &sign, (sign != 0) ? 1u : 0u, &digits[sizeof(digits) - count], count, 0u);
+}
+
+static long long fetch_signed(va_list *args, Format_Length_t length)
+{
+    switch (length)
+    {
+        case FORMAT_LENGTH_HH:
+            return (signed char)va_arg(*args, int);
+        case FORMAT_LENGTH_H:
+            return (short)va_arg(*args, int);
+        case FORMAT_LENGTH_L:
+            return va_arg(*args, long);
+        case FORMAT_LENGTH_LL:
+            return va_arg(*args, long long);
+        case FORMAT_LENGTH_J:
+            return (long long)va_arg(*args, intmax_t);
+        case FORMAT_LENGTH_Z:
+            return (long long)va_arg(*args, size_t);
+        case FORMAT_LENGTH_T:
+            return (long long)va_arg(*args, ptrdiff_t);
+        default:
+            return va_arg(*args, int);
+    }
+}
+
+static unsigned long long fetch_unsigned(va_list *args, Format_Length_t length)
+{
+    switch (length)
+    {
+        case FORMAT_LENGTH_HH:
+            return (unsigned char)va_arg(*args, unsigned int);
+        case FORMAT_LENGTH_H:
+            return (unsigned short)va_arg(*args, unsigned int);
+        case FORMAT_LENGTH_L:
+            return va_arg(*args, unsigned long);
+        case FORMAT_LENGTH_LL:
+            return va_arg(*args, unsigned long long);
+        case FORMAT_LENGTH_J:
+            return (unsigned long long)va_arg(*args, uintmax_t);
+        case FORMAT_LENGTH_Z:
+            return (unsigned long long)va_arg(*args, size_t);
+        case FORMAT_LENGTH_T:
+            return (unsigned long long)va_arg(*args, ptrdiff_t);
+        default:
+            return va_arg(*args, unsigned int);
+    }
+}
+
+/* Floating point argument, %Lf & co. take a long double */
+static double fetch_double(va_list *args, Format_Length_t length)
+{
+    return (length == FORMAT_LENGTH_BIG_L) ? (double)va_arg(*args, long double) : va_arg(*args, double);
+}
+
+/* Parses flags, width, precision and length; returns the conversion character position */
+static const char *parse_spec(const char *format, Format_Spec_t *spec, va_list *args)
+{
+    Format_Spec_t parsed = { 0, 0, 0, 0, 0, 0u, -1, FORMAT_LENGTH_NONE };
+
+    for (;; format++)
+    {
+        if (*format == '-')
+        {
+            parsed.left = 1;
+        }
+        else if (*format == '0')
+        {
+            parsed.zero = 1;
+        }
+        else if (*format == '+')
+        {
+            parsed.plus = 1;
+        }
+        else if (*format == ' ')
+        {
+            parsed.space = 1;
+        }
+        else if (*format == '#')
+        {
+            parsed.alternate = 1;
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    if (*format == '*')
+    {
+        int width = va_arg(*args, int);
+        if (width < 0)
+        {
+            parsed.left = 1;
+            width = -width;
+        }
+        parsed.width = (size_t)width;
+        format++;
+    }
+    else
+    {
+        while ((*format >= '0') && (*format <= '9'))
+        {
+            parsed.width = (parsed.width * 10u) + (size_t)(*format++ - '0');
+        }
+    }
+
+    if (*format == '.')
+    {
+        format++;
+        parsed.precision = 0;
+        if (*format == '*')
+        {
+            int precision = va_arg(*args, int);
+            parsed.precision = (precision < 0) ? -1 : precision;
+            format++;
+        }
+        else
+        {
+            while ((*format >= '0') && (*format <= '9'))
+            {
+                parsed.precision = (parsed.precision * 10) + (*format++ - '0');
+            }
+        }
+    }
+
+    switch (*format)
+    {
+        case 'h':
+            format++;
+            parsed.length = (*format == 'h') ? FORMAT_LENGTH_HH : FORMAT_LENGTH_H;
+            format += (parsed.length == FORMAT_LENGTH_HH) ? 1 : 0;
+            break;
+        case 'l':
+            format++;
+            parsed.length = (*format == 'l') ? FORMAT_LENGTH_LL : FORMAT_LENGTH_L;
+            format += (parsed.length == FORMAT_LENGTH_LL) ? 1 : 0;
+            break;
+        case 'j':
+            parsed.length = FORMAT_LENGTH_J;
+            format++;
+            break;
+        case 'z':
+            parsed.length = FORMAT_LENGTH_Z;
+            format++;
+            break;
+        case 't':
+            parsed.length = FORMAT_LENGTH_T;
+            format++;
+            break;
+        case 'L':
+            parsed.length = FORMAT_LENGTH_BIG_L;
+            format++;
+            break;
+        default:
+            break;
+    }
+
+    *spec = parsed;
+    return format;
+}
+
+static void format_string(Format_Out_t *out, const Format_Spec_t *spec, const char *string)
+{
+    size_t count = 0;
+    Format_Spec_t field = *spec;
+
+    if (string == NULL)
+    {
+        string = "(null)";
+    }
+    while ((string[count] != '\0') && ((spec->precision < 0) || (count < (size_t)spec->precision)))
+    {
+        count++;
+    }
+
+    field.zero = 0;
+    out_field(out, &field, "", 0u, string, count, 0u);
+}
+
+int Logging_FormatV(char *buffer, size_t size, const char *format, va_list args)
+{
+    Format_Out_t out = { buffer, (buffer != NULL) ? size : 0u, 0u };
+    Format_Spec_t spec;
+    const char *start;
+    va_list ap;
+
+    va_copy(ap, args);
+
+    while (*format != '\0')
+    {
+        if (*format != '%')
+        {
+            /* Literal run up to the next conversion */
+            start = format;
+            while ((*format != '\0') && (*format != '%'))
+            {
+                format++;
+            }
+            out_chars(&out, start, (size_t)(format - start));
+            continue;
+        }
+
+        start = format++;
+        format = parse_spec(format, &spec, &ap);
+
+        switch (*format)
+        {
+            case 'd':
+            case 'i':
+            {
+                long long value = fetch_signed(&ap, spec.length);
+                unsigned long long magnitude = (value < 0) ? (0u - (unsigned long long)value)
+                                                           : (unsigned long long)value;
+                format_integer(&out, &spec, magnitude, value < 0, 10u, 0, NULL);
+                break;
+            }
+            case 'u':
+                spec.plus = spec.space = 0;
+                format_integer(&out, &spec, fetch_unsigned(&ap, spec.length), 0, 10u, 0, NULL);
+                break;
+            case 'x':
+            case 'X':
+            {
+                unsigned long long value = fetch_unsigned(&ap, spec.length);
+                const char *base_prefix = (*format == 'X') ? "0X" : "0x";
+                spec.plus = spec.space = 0;
+                format_integer(&out, &spec, value, 0, 16u, *format == 'X',
+                               (spec.alternate && (value != 0u)) ? base_prefix : NULL);
+                break;
+            }
+            case 'p':
+                spec.plus = spec.space = 0;
+                format_integer(&out, &spec, (uintptr_t)va_arg(ap, void *), 0, 16u, 0, "0x");
+                break;
+            case 'f':
+            case 'F':
+                format_double(&out, &spec, fetch_double(&ap, spec.length), *format == 'F');
+                break;
+            case 's':
+                format_string(&out, &spec, va_arg(ap, const char *));
+                break;
+            case 'c':
+            {
+                char c = (char)va_arg(ap, int);
+                spec.zero = 0;
+                out_field(&out, &spec, "", 0u, &c, 1u, 0u);
+                break;
+            }
+            case '%':
+                out_char(&out, '%');
+                break;
+            case 'e':
+            case 'E':
+            case 'g':
+            case 'G':
+            case 'a':
+            case 'A':
+                (void)fetch_double(&ap, spec.length); /* Not printed, but the following arguments stay aligned */
+                out_chars(&out, start, (size_t)(format - start) + 1u);
+                break;
+            case 'o':
+                (void)fetch_unsigned(&ap, spec.length);
+                out_chars(&out, start, (size_t)(format - start) + 1u);
+                break;
+            case 'n':
+                (void)va_arg(ap, void *); /* Never written through */
+                out_chars(&out, start, (size_t)(format - start) + 1u);
+                break;
+            default:
+                /* Unknown conversion, copied as is */
+                out_chars(&out, start, (size_t)(format - start) + ((*format != '\0') ? 1u : 0u));
+                if (*format == '\0')
+                {
+                    continue;
+                }
+                break;
+        }
+        format++;
+    }
+
+    va_end(ap);
+
+    if (out.size > 0u)
+    {
+        out.buffer[(out.length < out.size) ? out.length : (out.size - 1u)] = '\0';
+    }
+
+    return (out.length > (size_t)INT_MAX) ? INT_MAX : (int)out.length;
+}
+
+int Logging_Format(char *buffer, size_t size, const char *format, ...)
+{
+    int result;
+    va_list args;
+
+    va_start(args, format);
+    result = Logging_FormatV(buffer, size, format, args);
+    va_end(args);
+
+    return result;
+}
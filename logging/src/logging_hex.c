@@ -0,0 +1,95 @@
+/**
+ * @file: logging_hex.c
+ * @author:: Paweł Kawula (pawel.kawula@kelectronics.pl)
+ * -----
+ * Copyright 2025 - KElectronics
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "logging.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define HEX_SIMD_SSE2
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define HEX_SIMD_NEON
+#endif
+
+/* Both characters of every byte value - one load and a 2-byte copy per byte */
+static const char hex_pairs[513] =
+    "000102030405060708090A0B0C0D0E0F101112131415161718191A1B1C1D1E1F"
+    "202122232425262728292A2B2C2D2E2F303132333435363738393A3B3C3D3E3F"
+    "404142434445464748494A4B4C4D4E4F505152535455565758595A5B5C5D5E5F"
+    "606162636465666768696A6B6C6D6E6F707172737475767778797A7B7C7D7E7F"
+    "808182838485868788898A8B8C8D8E8F909192939495969798999A9B9C9D9E9F"
+    "A0A1A2A3A4A5A6A7A8A9AAABACADAEAFB0B1B2B3B4B5B6B7B8B9BABBBCBDBEBF"
+    "C0C1C2C3C4C5C6C7C8C9CACBCCCDCECFD0D1D2D3D4D5D6D7D8D9DADBDCDDDEDF"
+    "E0E1E2E3E4E5E6E7E8E9EAEBECEDEEEFF0F1F2F3F4F5F6F7F8F9FAFBFCFDFEFF";
+
+#if defined(HEX_SIMD_SSE2)
+/* 16 bytes -> 32 characters: split nibbles, '0' + n (+7 above 9), interleave high/low */
+static void hex_encode_16(char *out, const uint8_t *in)
+{
+    const __m128i mask = _mm_set1_epi8(0x0F);
+    const __m128i nine = _mm_set1_epi8(9);
+    const __m128i digit = _mm_set1_epi8('0');
+    const __m128i letter = _mm_set1_epi8('A' - '0' - 10);
+    __m128i bytes = _mm_loadu_si128((const __m128i *)(const void *)in);
+    __m128i high = _mm_and_si128(_mm_srli_epi16(bytes, 4), mask);
+    __m128i low = _mm_and_si128(bytes, mask);
+
+    high = _mm_add_epi8(_mm_add_epi8(high, digit), _mm_and_si128(_mm_cmpgt_epi8(high, nine), letter));
+    low = _mm_add_epi8(_mm_add_epi8(low, digit), _mm_and_si128(_mm_cmpgt_epi8(low, nine), letter));
+
+    _mm_storeu_si128((__m128i *)(void *)out, _mm_unpacklo_epi8(high, low));
+    _mm_storeu_si128((__m128i *)(void *)(out + 16), _mm_unpackhi_epi8(high, low));
+}
+#elif defined(HEX_SIMD_NEON)
+/* 16 bytes -> 32 characters: nibble table lookup, interleaving store */
+static void hex_encode_16(char *out, const uint8_t *in)
+{
+    const uint8x16_t table = vld1q_u8((const uint8_t *)"0123456789ABCDEF");
+    uint8x16_t bytes = vld1q_u8(in);
+    uint8x16x2_t characters;
+
+    characters.val[0] = vqtbl1q_u8(table, vshrq_n_u8(bytes, 4));
+    characters.val[1] = vqtbl1q_u8(table, vandq_u8(bytes, vdupq_n_u8(0x0F)));
+    vst2q_u8((uint8_t *)out, characters);
+}
+#endif
+
+size_t Logging_HexEncode(char *buffer, size_t size, const void *data, size_t length)
+{
+    const uint8_t *bytes = (const uint8_t *)data;
+    size_t count;
+    size_t i = 0;
+
+    if (size == 0u)
+    {
+        return 0u;
+    }
+
+    count = (size - 1u) / 2u;
+    if (length < count)
+    {
+        count = length;
+    }
+
+#if defined(HEX_SIMD_SSE2) || defined(HEX_SIMD_NEON)
+    for (; (i + 16u) <= count; i += 16u)
+    {
+        hex_encode_16(&buffer[2u * i], &bytes[i]);
+    }
+#endif
+    for (; i < count; i++)
+    {
+        memcpy(&buffer[2u * i], &hex_pairs[2u * bytes[i]], 2u);
+    }
+
+    buffer[2u * count] = '\0';
+    return count;
+}
@@ -0,0 +1,111 @@
+/**
+ * @file: logging_internal.h
+ * @author: Paweł Kawula (pawel.kawula@kelectronics.pl)
+ * @brief: Helpers shared between the library translation units
+ * -----
+ * Copyright 2025 - KElectronics
+ * -----
+ * @note: Not part of the public interface.
+ */
+
+#ifndef LOGGING_INTERNAL_H
+#define LOGGING_INTERNAL_H
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "logging_atomic.h"
+#include "logging_format.h"
+#include "logging_levels.h"
+#include "logging_stack.h"
+#include "logging_types.h"
+
+/* No-op sink, installed before Logging_Init() and by Logging_Init(NULL) */
+int logging_default_log_function(const char *message, ...);
+
+#ifdef LOGGING_BATCH
+/* Deliver the partial batch once LOGGING_BATCH_FLUSH_INTERVAL_MS has passed (always when 0) */
+void logging_batch_poll(void);
+#endif
+
+#ifdef LOGGING_PANIC
+/* Set once by Logging_EnterPanic(), deferred commits then drain the ring themselves */
+extern uint8_t logging_panic;
+
+#ifdef LOGGING_BATCH
+/* Write the partial batch to a polled writer, without the batch function */
+void logging_batch_panic(Logging_WriteFunction_t write);
+#endif
+#ifdef LOGGING_DMA
+/* Write the half being filled to a polled writer and start no further transfers */
+void logging_dma_panic(Logging_WriteFunction_t write);
+#endif
+#ifdef LOGGING_DEFERRED
+/* Drain the ring to the current sink, ignoring a drain left unfinished by the faulting context */
+void logging_deferred_panic(void);
+#endif
+#endif
+
+/**
+ * @brief Publish a new sink for the log macros (release store).
+ *
+ * Everything the sink needs must be set up before this call.
+ */
+static inline void logging_set_sink(Logging_Function_t sink)
+{
+    LOGGING_ATOMIC_STORE_RELEASE(&log_function, sink);
+}
+
+/**
+ * @brief Recover the level of a message from its level tag.
+ *
+ * The log macros always start the format literal with the level tag
+ * ("[ERROR] ", "[WARN]  ", "[INFO]  ", "[DEBUG] "), so the level is one
+ * byte load away and does not need an extra argument.
+ *
+ * @return int LOG_ERROR ... LOG_DEBUG, LOG_NONE for untagged messages.
+ */
+static inline int logging_message_level(const char *message)
+{
+    if ((message == 0) || (message[0] != '['))
+    {
+        return LOG_NONE;
+    }
+
+    switch (message[1])
+    {
+        case 'E':
+            return LOG_ERROR;
+        case 'W':
+            return LOG_WARN;
+        case 'I':
+            return LOG_INFO;
+        case 'D':
+            return LOG_DEBUG;
+        default:
+            return LOG_NONE;
+    }
+}
+
+/**
+ * @brief Format one log line, a truncated line keeps its "\r\n" ending.
+ *
+ * @param buffer Destination, at least 4 bytes.
+ * @return size_t Length of the line in buffer (without the NUL).
+ */
+static inline size_t logging_format_line(char *buffer, size_t size, const char *message, va_list args)
+{
+    size_t length = (size_t)Logging_FormatV(buffer, size, message, args);
+
+    if (length >= size)
+    {
+        length = size - 1u;
+        buffer[length - 2u] = '\r';
+        buffer[length - 1u] = '\n';
+    }
+
+    return length;
+}
+
+#endif /* LOGGING_INTERNAL_H */
@@ -0,0 +1,161 @@
+/**
+ * @file: logging_kv.c
+ * @author:: Paweł Kawula (pawel.kawula@kelectronics.pl)
+ * -----
+ * Copyright 2025 - KElectronics
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "logging.h"
+#include "logging_kv.h"
+
+#ifdef LOGGING_KV
+
+#if (LOGGING_KV_BUFFER_SIZE < 16) || (LOGGING_KV_BUFFER_SIZE > 65537)
+#error "LOGGING_KV_BUFFER_SIZE must be in range 16..65537."
+#endif
+
+static Logging_WriteFunction_t kv_write = NULL;
+
+typedef struct
+{
+    uint8_t *data;
+    size_t length;
+    size_t capacity;
+    int truncated;
+} KV_Record_t;
+
+static void record_put_le(uint8_t *data, uint64_t value, size_t size)
+{
+    for (size_t i = 0; i < size; i++)
+    {
+        data[i] = (uint8_t)(value >> (8u * i));
+    }
+}
+
+/* u8 length + characters, cut to the room left when cut is set */
+static int record_put_text(KV_Record_t *record, const char *text, int cut)
+{
+    size_t length = (text != NULL) ? strlen(text) : 0u;
+    size_t room = record->capacity - record->length;
+
+    if (length > 255u)
+    {
+        length = 255u;
+        record->truncated = 1;
+    }
+    if ((length + 1u) > room)
+    {
+        if (!cut || (room == 0u))
+        {
+            return 0;
+        }
+        length = room - 1u;
+        record->truncated = 1;
+    }
+
+    record->data[record->length++] = (uint8_t)length;
+    memcpy(&record->data[record->length], text, length);
+    record->length += length;
+    return 1;
+}
+
+static void record_put_field(KV_Record_t *record, const Logging_KVField_t *field)
+{
+    size_t start = record->length;
+    size_t value_size;
+    uint64_t value;
+
+    switch (field->type)
+    {
+        case LOGGING_KV_TYPE_U32:
+        case LOGGING_KV_TYPE_I32:
+            value_size = 4u;
+            value = field->value.u32;
+            break;
+        case LOGGING_KV_TYPE_U64:
+        case LOGGING_KV_TYPE_I64:
+            value_size = 8u;
+            value = field->value.u64;
+            break;
+        case LOGGING_KV_TYPE_F32:
+        {
+            uint32_t bits;
+            memcpy(&bits, &field->value.f32, sizeof(bits));
+            value_size = 4u;
+            value = bits;
+            break;
+        }
+        case LOGGING_KV_TYPE_BOOL:
+            value_size = 1u;
+            value = field->value.u32;
+            break;
+        case LOGGING_KV_TYPE_STR:
+            value_size = 0u;
+            value = 0u;
+            break;
+        default:
+            return;
+    }
+
+    /* Type byte, complete key, then the value - a field is never split */
+    if (record->length < record->capacity)
+    {
+        record->data[record->length++] = field->type;
+        if (record_put_text(record, field->key, 0))
+        {
+            if (field->type == LOGGING_KV_TYPE_STR)
+            {
+                if (record_put_text(record, field->value.str, 1))
+                {
+                    return;
+                }
+            }
+            else if ((record->capacity - record->length) >= value_size)
+            {
+                record_put_le(&record->data[record->length], value, value_size);
+                record->length += value_size;
+                return;
+            }
+        }
+    }
+
+    record->length = start;
+    record->truncated = 1;
+}
+
+void Logging_InitKV(Logging_WriteFunction_t write_func)
+{
+    kv_write = write_func;
+}
+
+void Logging_KVLog(uint8_t level, uint16_t module, uint16_t line, const char *event,
+                   const Logging_KVField_t *fields, size_t count)
+{
+    uint8_t buffer[LOGGING_KV_BUFFER_SIZE];
+    Logging_WriteFunction_t write = kv_write;
+    KV_Record_t record = { buffer, LOGGING_KV_HEADER_SIZE, sizeof(buffer), 0 };
+
+    if (write == NULL)
+    {
+        return;
+    }
+
+    (void)record_put_text(&record, event, 1);
+    for (size_t i = 0; i < count; i++)
+    {
+        record_put_field(&record, &fields[i]);
+    }
+
+    record_put_le(&buffer[0], record.length - 2u, 2u);
+    buffer[2] = (uint8_t)((level & LOGGING_KV_LEVEL_MASK) | (record.truncated ? LOGGING_KV_FLAG_TRUNCATED : 0u));
+    record_put_le(&buffer[3], module, 2u);
+    record_put_le(&buffer[5], line, 2u);
+
+    (void)write(buffer, record.length);
+}
+
+#endif /* LOGGING_KV */
@@ -0,0 +1,58 @@
+/**
+ * @file: logging_panic.c
+ * @author:: Paweł Kawula (pawel.kawula@kelectronics.pl)
+ * -----
+ * Copyright 2025 - KElectronics
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "logging.h"
+#include "logging_atomic.h"
+#include "logging_internal.h"
+
+#ifdef LOGGING_PANIC
+
+uint8_t logging_panic = 0;
+
+void Logging_EnterPanic(Logging_WriteFunction_t panic_write)
+{
+    if (panic_write == NULL)
+    {
+        return;
+    }
+
+    /* Every output points at the polled writer before anything is drained */
+    Logging_InitWrite(panic_write);
+#ifdef LOGGING_TOKENIZED
+    Logging_InitTokenized(panic_write);
+#endif
+#ifdef LOGGING_KV
+    Logging_InitKV(panic_write);
+#endif
+#ifdef LOGGING_TRACE
+    Logging_InitTrace(NULL); /* Binary events would interleave with the panic text */
+#endif
+
+    /* Downstream stages hold the oldest records */
+#ifdef LOGGING_DMA
+    logging_dma_panic(panic_write);
+#endif
+#ifdef LOGGING_BATCH
+    logging_batch_panic(panic_write);
+#endif
+
+    LOGGING_ATOMIC_STORE_RELEASE(&logging_panic, 1u);
+
+#ifdef LOGGING_DEFERRED
+    logging_deferred_panic();
+#endif
+}
+
+int Logging_InPanic(void)
+{
+    return (LOGGING_ATOMIC_LOAD_ACQUIRE(&logging_panic) != 0u) ? 1 : 0;
+}
+
+#endif /* LOGGING_PANIC */
@@ -0,0 +1,190 @@
+/**
+ * @file: logging_persist.c
+ * @author:: Paweł Kawula (pawel.kawula@kelectronics.pl)
+ * -----
+ * Copyright 2025 - KElectronics
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "logging.h"
+#include "logging_atomic.h"
+#include "logging_internal.h"
+
+#ifdef LOGGING_PERSIST
+
+#if LOGGING_PERSIST_RECORDS < 1
+#error "LOGGING_PERSIST_RECORDS must be at least 1."
+#endif
+
+#if (LOGGING_PERSIST_RECORD_SIZE < 8) || (LOGGING_PERSIST_RECORD_SIZE > 256)
+#error "LOGGING_PERSIST_RECORD_SIZE must be in range 8..256."
+#endif
+
+#define PERSIST_MAGIC 0x4C4F4750u /* "LOGP" */
+
+/* Record: CRC of the text | text length | NUL terminated text */
+#define PERSIST_TEXT_SIZE (LOGGING_PERSIST_RECORD_SIZE - 5u)
+
+typedef struct
+{
+    uint32_t crc;
+    uint8_t length;
+    char text[PERSIST_TEXT_SIZE];
+} Persist_Record_t;
+
+typedef struct
+{
+    uint32_t magic;
+    uint32_t layout; /* Record count and size, a changed build does not replay */
+    uint32_t written; /* Records written since the region was cleared */
+    uint32_t crc;     /* Over the fields above */
+    Persist_Record_t records[LOGGING_PERSIST_RECORDS];
+} Persist_Region_t;
+
+#define PERSIST_LAYOUT (((uint32_t)LOGGING_PERSIST_RECORDS << 16) | (uint32_t)LOGGING_PERSIST_RECORD_SIZE)
+
+static Persist_Region_t persist_region __attribute__((section(LOGGING_PERSIST_SECTION)));
+static uint8_t persist_busy = 0;
+static uint8_t persist_checked = 0;
+
+/* CRC-32 (IEEE), nibble table - small and fast enough for a few dozen bytes */
+static uint32_t persist_crc(uint32_t crc, const void *data, size_t length)
+{
+    static const uint32_t table[16] = {
+        0x00000000u, 0x1DB71064u, 0x3B6E20C8u, 0x26D930ACu, 0x76DC4190u, 0x6B6B51F4u, 0x4DB26158u, 0x5005713Cu,
+        0xEDB88320u, 0xF00F9344u, 0xD6D6A3E8u, 0xCB61B38Cu, 0x9B64C2B0u, 0x86D3D2D4u, 0xA00AE278u, 0xBDBDF21Cu,
+    };
+    const uint8_t *bytes = (const uint8_t *)data;
+
+    crc = ~crc;
+    while (length-- > 0u)
+    {
+        crc ^= *bytes++;
+        crc = (crc >> 4) ^ table[crc & 0x0Fu];
+        crc = (crc >> 4) ^ table[crc & 0x0Fu];
+    }
+    return ~crc;
+}
+
+static uint32_t persist_header_crc(void)
+{
+    return persist_crc(0u, &persist_region, offsetof(Persist_Region_t, crc));
+}
+
+static int persist_header_valid(void)
+{
+    return (persist_region.magic == PERSIST_MAGIC) && (persist_region.layout == PERSIST_LAYOUT) &&
+           (persist_region.crc == persist_header_crc());
+}
+
+static void persist_reset(void)
+{
+    persist_region.magic = PERSIST_MAGIC;
+    persist_region.layout = PERSIST_LAYOUT;
+    persist_region.written = 0u;
+    persist_region.crc = persist_header_crc();
+}
+
+int Logging_PersistWrite(const uint8_t *data, size_t length)
+{
+    Persist_Record_t *record;
+
+    if (LOGGING_ATOMIC_EXCHANGE_ACQUIRE(&persist_busy, 1u) != 0u)
+    {
+        return -1;
+    }
+
+    /* First write after reset: keep valid retained content, start over otherwise */
+    if (!persist_checked)
+    {
+        if (!persist_header_valid())
+        {
+            persist_reset();
+        }
+        persist_checked = 1u;
+    }
+
+    /* Record first, header last - a reset in between loses only this message */
+    record = &persist_region.records[persist_region.written % LOGGING_PERSIST_RECORDS];
+    if (length > (PERSIST_TEXT_SIZE - 1u))
+    {
+        /* Truncated - keep the line ending */
+        length = PERSIST_TEXT_SIZE - 1u;
+        memcpy(record->text, data, length);
+        record->text[length - 2u] = '\r';
+        record->text[length - 1u] = '\n';
+    }
+    else
+    {
+        memcpy(record->text, data, length);
+    }
+    record->text[length] = '\0';
+    record->length = (uint8_t)length;
+    record->crc = persist_crc(0u, record->text, length);
+
+    persist_region.written++;
+    persist_region.crc = persist_header_crc();
+
+    LOGGING_ATOMIC_STORE_RELEASE(&persist_busy, 0u);
+    return (int)length;
+}
+
+size_t Logging_RecoverPersisted(void)
+{
+    uint32_t count;
+    uint32_t first;
+    uint32_t i;
+    size_t replayed = 0;
+
+    /* Held during the replay, so messages it produces are not retained twice */
+    if (LOGGING_ATOMIC_EXCHANGE_ACQUIRE(&persist_busy, 1u) != 0u)
+    {
+        return 0u;
+    }
+
+    if (persist_header_valid())
+    {
+        count = (persist_region.written < LOGGING_PERSIST_RECORDS) ? persist_region.written
+                                                                   : LOGGING_PERSIST_RECORDS;
+        first = persist_region.written - count;
+
+        for (i = 0; i < count; i++)
+        {
+            const Persist_Record_t *record = &persist_region.records[(first + i) % LOGGING_PERSIST_RECORDS];
+
+            /* Skip torn or corrupted records */
+            if ((record->length >= PERSIST_TEXT_SIZE) || (record->text[record->length] != '\0') ||
+                (record->crc != persist_crc(0u, record->text, record->length)))
+            {
+                continue;
+            }
+
+            (void)LOGGING_CURRENT_SINK()("%s", record->text);
+            replayed++;
+        }
+    }
+
+    persist_reset();
+    persist_checked = 1u;
+
+    LOGGING_ATOMIC_STORE_RELEASE(&persist_busy, 0u);
+    return replayed;
+}
+
+void Logging_PersistClear(void)
+{
+    if (LOGGING_ATOMIC_EXCHANGE_ACQUIRE(&persist_busy, 1u) != 0u)
+    {
+        return;
+    }
+
+    persist_reset();
+    persist_checked = 1u;
+
+    LOGGING_ATOMIC_STORE_RELEASE(&persist_busy, 0u);
+}
+
+#endif /* LOGGING_PERSIST */
@@ -0,0 +1,122 @@
+/**
+ * @file: logging_sinks.c
+ * @author:: Paweł Kawula (pawel.kawula@kelectronics.pl)
+ * -----
+ * Copyright 2025 - KElectronics
+ */
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "logging.h"
+#include "logging_atomic.h"
+#include "logging_internal.h"
+
+#ifdef LOGGING_MULTI_SINK
+
+#if LOGGING_SINK_BUFFER_SIZE < 4
+#error "LOGGING_SINK_BUFFER_SIZE must be at least 4."
+#endif
+
+typedef struct
+{
+    Logging_WriteFunction_t write;
+    uint8_t level_mask;
+} Sink_Slot_t;
+
+static Sink_Slot_t sink_table[LOGGING_MAX_SINKS];
+static uint32_t sink_dropped = 0;
+
+/* Installed as log_function while the sink table is in use */
+static int sink_table_entry(const char *message, ...)
+{
+    char buffer[LOGGING_SINK_BUFFER_SIZE];
+    int level = logging_message_level(message);
+    uint8_t level_bit = (level == LOG_NONE) ? LOGGING_ALL_LEVELS : LOGGING_LEVEL_MASK(level);
+    size_t length;
+    int i;
+    va_list args;
+
+    /* Format once, shared by every sink; on the caller's stack, so concurrent callers need no lock */
+    va_start(args, message);
+    length = logging_format_line(buffer, sizeof(buffer), message, args);
+    va_end(args);
+
+    for (i = 0; i < LOGGING_MAX_SINKS; i++)
+    {
+        Logging_WriteFunction_t write = LOGGING_ATOMIC_LOAD_ACQUIRE(&sink_table[i].write);
+
+        if ((write != NULL) && ((sink_table[i].level_mask & level_bit) != 0u))
+        {
+            if (write((const uint8_t *)buffer, length) <= 0)
+            {
+                LOGGING_ATOMIC_FETCH_ADD_RELAXED(&sink_dropped, 1u);
+            }
+        }
+    }
+
+    return (int)length;
+}
+
+int Logging_AddSink(Logging_WriteFunction_t write_func, uint8_t level_mask)
+{
+    int i;
+
+    if (write_func == NULL)
+    {
+        return -1;
+    }
+
+    for (i = 0; i < LOGGING_MAX_SINKS; i++)
+    {
+        if (sink_table[i].write == NULL)
+        {
+            sink_table[i].level_mask = level_mask;
+            LOGGING_ATOMIC_STORE_RELEASE(&sink_table[i].write, write_func);
+            logging_set_sink(sink_table_entry);
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+int Logging_RemoveSink(Logging_WriteFunction_t write_func)
+{
+    int i;
+
+    for (i = 0; i < LOGGING_MAX_SINKS; i++)
+    {
+        if ((write_func != NULL) && (sink_table[i].write == write_func))
+        {
+            LOGGING_ATOMIC_STORE_RELEASE(&sink_table[i].write, (Logging_WriteFunction_t)NULL);
+            return 0;
+        }
+    }
+
+    return -1;
+}
+
+int Logging_SetSinkMask(Logging_WriteFunction_t write_func, uint8_t level_mask)
+{
+    int i;
+
+    for (i = 0; i < LOGGING_MAX_SINKS; i++)
+    {
+        if ((write_func != NULL) && (sink_table[i].write == write_func))
+        {
+            sink_table[i].level_mask = level_mask;
+            return 0;
+        }
+    }
+
+    return -1;
+}
+
+uint32_t Logging_GetSinkDropped(void)
+{
+    return LOGGING_ATOMIC_LOAD_RELAXED(&sink_dropped);
+}
+
+#endif /* LOGGING_MULTI_SINK */
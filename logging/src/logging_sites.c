@@ -0,0 +1,65 @@
+/**
+ * @file: logging_sites.c
+ * @author:: Paweł Kawula (pawel.kawula@kelectronics.pl)
+ * -----
+ * Copyright 2025 - KElectronics
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "logging.h"
+#include "logging_sites.h"
+
+#ifdef LOGGING_SITES
+
+/* Section bounds from the linker; weak so that an image without any site still links */
+extern Logging_Site_t __start_logging_sites[] __attribute__((weak));
+extern Logging_Site_t __stop_logging_sites[] __attribute__((weak));
+
+size_t Logging_GetSiteCount(void)
+{
+    if ((__start_logging_sites == NULL) || (__stop_logging_sites == NULL))
+    {
+        return 0;
+    }
+    return (size_t)(__stop_logging_sites - __start_logging_sites);
+}
+
+const Logging_Site_t *Logging_GetSite(size_t id)
+{
+    return (id < Logging_GetSiteCount()) ? &__start_logging_sites[id] : NULL;
+}
+
+int Logging_SetSiteEnabled(size_t id, int on)
+{
+    if (id >= Logging_GetSiteCount())
+    {
+        return -1;
+    }
+
+    __start_logging_sites[id].enabled = (uint8_t)((on != 0) ? 1u : 0u);
+    return 0;
+}
+
+size_t Logging_SetSitesEnabled(const char *file, unsigned line, int on)
+{
+    size_t count = Logging_GetSiteCount();
+    size_t changed = 0;
+
+    for (size_t id = 0; id < count; id++)
+    {
+        Logging_Site_t *site = &__start_logging_sites[id];
+
+        if (((file == NULL) || (strcmp(site->file, file) == 0)) && ((line == 0u) || (site->line == line)))
+        {
+            site->enabled = (uint8_t)((on != 0) ? 1u : 0u);
+            changed++;
+        }
+    }
+
+    return changed;
+}
+
+#endif /* LOGGING_SITES */
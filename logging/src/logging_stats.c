@@ -0,0 +1,88 @@
+/**
+ * @file: logging_stats.c
+ * @author:: Paweł Kawula (pawel.kawula@kelectronics.pl)
+ * -----
+ * Copyright 2025 - KElectronics
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "logging.h"
+#include "logging_internal.h"
+
+#ifdef LOGGING_STATS
+
+Logging_StatsNode_t logging_unnamed_stats = { "", 0u, { 0 }, { 0 }, NULL };
+
+/* Built by constructors before main(), read-only afterwards */
+static Logging_StatsNode_t *stats_list = &logging_unnamed_stats;
+
+void Logging_RegisterStats(Logging_StatsNode_t *node)
+{
+    if (node)
+    {
+        node->next = stats_list;
+        stats_list = node;
+    }
+}
+
+size_t Logging_GetStats(Logging_Stats_t *stats, size_t max)
+{
+    size_t count = 0u;
+    const Logging_StatsNode_t *node;
+    const Logging_StatsNode_t *first;
+
+    for (node = stats_list; node != NULL; node = node->next)
+    {
+        /* Translation units of one module are merged into the entry of the first node with that name */
+        for (first = stats_list; strcmp(first->name, node->name) != 0; first = first->next)
+        {
+        }
+        if (first != node)
+        {
+            continue;
+        }
+
+        if (count < max)
+        {
+            Logging_Stats_t *entry = &stats[count];
+
+            entry->name = node->name;
+            entry->id = node->id;
+            memset(entry->emitted, 0, sizeof(entry->emitted));
+            memset(entry->dropped, 0, sizeof(entry->dropped));
+
+            for (const Logging_StatsNode_t *part = node; part != NULL; part = part->next)
+            {
+                if (strcmp(part->name, node->name) != 0)
+                {
+                    continue;
+                }
+                for (size_t level = 0; level < LOGGING_STATS_LEVELS; level++)
+                {
+                    entry->emitted[level] += LOGGING_ATOMIC_LOAD_RELAXED(&part->emitted[level]);
+                    entry->dropped[level] += LOGGING_ATOMIC_LOAD_RELAXED(&part->dropped[level]);
+                }
+            }
+        }
+        count++;
+    }
+
+    return count;
+}
+
+void Logging_ResetStats(void)
+{
+    for (Logging_StatsNode_t *node = stats_list; node != NULL; node = node->next)
+    {
+        for (size_t level = 0; level < LOGGING_STATS_LEVELS; level++)
+        {
+            LOGGING_ATOMIC_STORE_RELAXED(&node->emitted[level], 0u);
+            LOGGING_ATOMIC_STORE_RELAXED(&node->dropped[level], 0u);
+        }
+    }
+}
+
+#endif /* LOGGING_STATS */
@@ -0,0 +1,158 @@
+/**
+ * @file: logging_tokens.c
+ * @author:: Paweł Kawula (pawel.kawula@kelectronics.pl)
+ * -----
+ * Copyright 2025 - KElectronics
+ */
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "logging.h"
+
+#ifdef LOGGING_TOKENIZED
+
+#if (LOGGING_TOKEN_BUFFER_SIZE < 8) || (LOGGING_TOKEN_BUFFER_SIZE > 16383)
+#error "LOGGING_TOKEN_BUFFER_SIZE must be in range 8..16383."
+#endif
+
+/* Space for the varint frame length in front of the payload */
+#define TOKEN_LENGTH_PREFIX 2u
+
+static Logging_WriteFunction_t token_write = NULL;
+
+typedef struct
+{
+    uint8_t *data;
+    size_t length;
+    size_t capacity;
+    int truncated;
+} Token_Frame_t;
+
+static void frame_put_byte(Token_Frame_t *frame, uint8_t byte)
+{
+    if (frame->length < frame->capacity)
+    {
+        frame->data[frame->length++] = byte;
+    }
+    else
+    {
+        frame->truncated = 1;
+    }
+}
+
+static void frame_put_varint(Token_Frame_t *frame, uint64_t value)
+{
+    while (value >= 0x80u)
+    {
+        frame_put_byte(frame, (uint8_t)(value | 0x80u));
+        value >>= 7;
+    }
+    frame_put_byte(frame, (uint8_t)value);
+}
+
+static void frame_put_zigzag(Token_Frame_t *frame, int64_t value)
+{
+    frame_put_varint(frame, ((uint64_t)value << 1) ^ (uint64_t)(value >> 63));
+}
+
+static void frame_put_string(Token_Frame_t *frame, const char *string)
+{
+    size_t length = (string != NULL) ? strlen(string) : 0u;
+    size_t room = frame->capacity - frame->length;
+
+    /* Length varint takes at most 2 bytes for the allowed buffer sizes */
+    if (room < 2u)
+    {
+        frame->truncated = 1;
+        return;
+    }
+    if (length > (room - 2u))
+    {
+        length = room - 2u;
+        frame->truncated = 1;
+    }
+
+    frame_put_varint(frame, length);
+    memcpy(&frame->data[frame->length], string, length);
+    frame->length += length;
+}
+
+void Logging_InitTokenized(Logging_WriteFunction_t write_func)
+{
+    token_write = write_func;
+}
+
+void Logging_TokenLog(uint32_t token, uint32_t types, ...)
+{
+    uint8_t buffer[TOKEN_LENGTH_PREFIX + LOGGING_TOKEN_BUFFER_SIZE];
+    Token_Frame_t frame = { &buffer[TOKEN_LENGTH_PREFIX], 0, LOGGING_TOKEN_BUFFER_SIZE, 0 };
+    unsigned count = LOGGING_ARG_TYPES_COUNT(types);
+    unsigned i;
+    size_t start;
+    va_list args;
+
+    if (token_write == NULL)
+    {
+        return;
+    }
+
+    frame_put_byte(&frame, (uint8_t)token);
+    frame_put_byte(&frame, (uint8_t)(token >> 8));
+    frame_put_byte(&frame, (uint8_t)(token >> 16));
+    frame_put_byte(&frame, (uint8_t)(token >> 24));
+
+    va_start(args, types);
+    for (i = 0; (i < count) && !frame.truncated; i++)
+    {
+        switch (LOGGING_ARG_TYPES_AT(types, i))
+        {
+            case LOGGING_ARG_INT32:
+                frame_put_zigzag(&frame, va_arg(args, int));
+                break;
+            case LOGGING_ARG_INT64:
+                frame_put_zigzag(&frame, va_arg(args, long long));
+                break;
+            case LOGGING_ARG_DOUBLE:
+            {
+                float value = (float)va_arg(args, double);
+                uint32_t bits;
+                memcpy(&bits, &value, sizeof(bits));
+                frame_put_byte(&frame, (uint8_t)bits);
+                frame_put_byte(&frame, (uint8_t)(bits >> 8));
+                frame_put_byte(&frame, (uint8_t)(bits >> 16));
+                frame_put_byte(&frame, (uint8_t)(bits >> 24));
+                break;
+            }
+            case LOGGING_ARG_STRING:
+                frame_put_string(&frame, va_arg(args, const char *));
+                break;
+            case LOGGING_ARG_POINTER:
+                frame_put_varint(&frame, (uintptr_t)va_arg(args, void *));
+                break;
+            default:
+                frame.truncated = 1; /* Unknown type, stop decoding arguments */
+                break;
+        }
+    }
+    va_end(args);
+
+    /* Frame = varint(length) | payload, length prefix written right before the payload */
+    if (frame.length < 0x80u)
+    {
+        start = TOKEN_LENGTH_PREFIX - 1u;
+        buffer[start] = (uint8_t)frame.length;
+    }
+    else
+    {
+        start = 0u;
+        buffer[0] = (uint8_t)(frame.length | 0x80u);
+        buffer[1] = (uint8_t)(frame.length >> 7);
+    }
+
+    (void)token_write(&buffer[start], (TOKEN_LENGTH_PREFIX - start) + frame.length);
+}
+
+#endif /* LOGGING_TOKENIZED */
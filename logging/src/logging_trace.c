@@ -0,0 +1,52 @@
+/**
+ * @file: logging_trace.c
+ * @author:: Paweł Kawula (pawel.kawula@kelectronics.pl)
+ * -----
+ * Copyright 2025 - KElectronics
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "logging.h"
+#include "logging_trace.h"
+
+#if defined(LOGGING_TRACE) && defined(LOGGING_TIMESTAMP)
+
+/* length, phase, track, name */
+#define TRACE_HEADER_SIZE 7u
+
+static Logging_WriteFunction_t trace_write = NULL;
+
+void Logging_InitTrace(Logging_WriteFunction_t write_func)
+{
+    trace_write = write_func;
+}
+
+void Logging_TraceEvent(uint8_t phase, uint32_t name, Logging_Timestamp_t timestamp)
+{
+    uint8_t event[TRACE_HEADER_SIZE + sizeof(Logging_Timestamp_t)];
+    Logging_WriteFunction_t write = trace_write;
+    size_t i;
+
+    if (write == NULL)
+    {
+        return;
+    }
+
+    event[0] = (uint8_t)(sizeof(event) - 1u);
+    event[1] = phase;
+    event[2] = (uint8_t)(LOGGING_TRACE_TRACK());
+    for (i = 0; i < 4u; i++)
+    {
+        event[3u + i] = (uint8_t)(name >> (8u * i));
+    }
+    for (i = 0; i < sizeof(Logging_Timestamp_t); i++)
+    {
+        event[TRACE_HEADER_SIZE + i] = (uint8_t)((uint64_t)timestamp >> (8u * i));
+    }
+
+    (void)write(event, sizeof(event));
+}
+
+#endif /* LOGGING_TRACE */
@@ -0,0 +1,309 @@
+/**
+ * @file: logging_kv_decode.c
+ * @author:: Paweł Kawula (pawel.kawula@kelectronics.pl)
+ * -----
+ * Copyright 2025 - KElectronics
+ */
+
+#include <math.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "logging_kv_decode.h"
+#include "logging_levels.h"
+#include "logging_module.h"
+
+static uint64_t read_le(const uint8_t *data, size_t size)
+{
+    uint64_t value = 0u;
+
+    for (size_t i = 0; i < size; i++)
+    {
+        value |= (uint64_t)data[i] << (8u * i);
+    }
+    return value;
+}
+
+long Logging_KVDecode(const uint8_t *data, size_t length, Logging_KVRecord_t *record)
+{
+    size_t total;
+    size_t event_length;
+
+    if (length < 2u)
+    {
+        return 0;
+    }
+
+    total = (size_t)read_le(data, 2u) + 2u;
+    if (total < (LOGGING_KV_HEADER_SIZE + 1u))
+    {
+        return -1;
+    }
+    if (length < total)
+    {
+        return 0;
+    }
+
+    event_length = data[LOGGING_KV_HEADER_SIZE];
+    if ((LOGGING_KV_HEADER_SIZE + 1u + event_length) > total)
+    {
+        return -1;
+    }
+
+    record->level = (uint8_t)(data[2] & LOGGING_KV_LEVEL_MASK);
+    record->truncated = (uint8_t)((data[2] & LOGGING_KV_FLAG_TRUNCATED) != 0u);
+    record->module = (uint16_t)read_le(&data[3], 2u);
+    record->line = (uint16_t)read_le(&data[5], 2u);
+    record->event = (const char *)&data[LOGGING_KV_HEADER_SIZE + 1u];
+    record->event_length = event_length;
+    record->fields = &data[LOGGING_KV_HEADER_SIZE + 1u + event_length];
+    record->fields_length = total - (LOGGING_KV_HEADER_SIZE + 1u + event_length);
+
+    return (long)total;
+}
+
+int Logging_KVNextField(const Logging_KVRecord_t *record, size_t *offset, Logging_KVValue_t *field)
+{
+    const uint8_t *data = record->fields;
+    size_t length = record->fields_length;
+    size_t position = *offset;
+    size_t value_size;
+
+    if (position >= length)
+    {
+        return 0;
+    }
+    if ((length - position) < 2u)
+    {
+        return -1;
+    }
+
+    field->type = data[position++];
+    field->key_length = data[position++];
+    if ((length - position) < field->key_length)
+    {
+        return -1;
+    }
+    field->key = (const char *)&data[position];
+    position += field->key_length;
+
+    switch (field->type)
+    {
+        case LOGGING_KV_TYPE_U32:
+        case LOGGING_KV_TYPE_I32:
+        case LOGGING_KV_TYPE_F32:
+            value_size = 4u;
+            break;
+        case LOGGING_KV_TYPE_U64:
+        case LOGGING_KV_TYPE_I64:
+            value_size = 8u;
+            break;
+        case LOGGING_KV_TYPE_BOOL:
+        case LOGGING_KV_TYPE_STR:
+            value_size = 1u;
+            break;
+        default:
+            return -1;
+    }
+    if ((length - position) < value_size)
+    {
+        return -1;
+    }
+
+    switch (field->type)
+    {
+        case LOGGING_KV_TYPE_U32:
+            field->value.u32 = (uint32_t)read_le(&data[position], 4u);
+            break;
+        case LOGGING_KV_TYPE_I32:
+            field->value.i32 = (int32_t)(uint32_t)read_le(&data[position], 4u);
+            break;
+        case LOGGING_KV_TYPE_F32:
+        {
+            uint32_t bits = (uint32_t)read_le(&data[position], 4u);
+            memcpy(&field->value.f32, &bits, sizeof(bits));
+            break;
+        }
+        case LOGGING_KV_TYPE_U64:
+            field->value.u64 = read_le(&data[position], 8u);
+            break;
+        case LOGGING_KV_TYPE_I64:
+            field->value.i64 = (int64_t)read_le(&data[position], 8u);
+            break;
+        case LOGGING_KV_TYPE_BOOL:
+            field->value.boolean = (data[position] != 0u);
+            break;
+        default: /* LOGGING_KV_TYPE_STR */
+            field->value.str.length = data[position];
+            if ((length - position - 1u) < field->value.str.length)
+            {
+                return -1;
+            }
+            field->value.str.data = (const char *)&data[position + 1u];
+            value_size += field->value.str.length;
+            break;
+    }
+
+    *offset = position + value_size;
+    return 1;
+}
+
+uint16_t Logging_KVModuleId(const char *name)
+{
+    /* Same hash as LOGGING_MODULE_HASH() in logging_module.h */
+    size_t length = strlen(name);
+    uint32_t hash = (uint32_t)length;
+    uint32_t coefficient = 65599u;
+
+    for (size_t i = 0; (i < length) && (i < LOGGING_MODULE_HASH_LENGTH); i++)
+    {
+        hash += (uint32_t)(unsigned char)name[i] * coefficient;
+        coefficient *= 65599u;
+    }
+
+    return (uint16_t)((hash % 65535u) + 1u);
+}
+
+typedef struct
+{
+    char *data;
+    size_t size;
+    size_t length;
+} Json_Output_t;
+
+static void json_append(Json_Output_t *out, const char *format, ...)
+{
+    char *position = (out->length < out->size) ? &out->data[out->length] : NULL;
+    size_t room = (out->length < out->size) ? out->size - out->length : 0u;
+    va_list args;
+    int written;
+
+    va_start(args, format);
+    written = vsnprintf(position, room, format, args);
+    va_end(args);
+
+    if (written > 0)
+    {
+        out->length += (size_t)written;
+    }
+}
+
+static void json_append_string(Json_Output_t *out, const char *text, size_t length)
+{
+    json_append(out, "\"");
+    for (size_t i = 0; i < length; i++)
+    {
+        unsigned char c = (unsigned char)text[i];
+
+        if ((c == '"') || (c == '\\'))
+        {
+            json_append(out, "\\%c", c);
+        }
+        else if (c < 0x20u)
+        {
+            json_append(out, "\\u%04x", c);
+        }
+        else
+        {
+            if ((out->length + 1u) < out->size)
+            {
+                out->data[out->length] = (char)c;
+                out->data[out->length + 1u] = '\0';
+            }
+            out->length++;
+        }
+    }
+    json_append(out, "\"");
+}
+
+static const char *level_name(uint8_t level)
+{
+    switch (level)
+    {
+        case LOG_ERROR:
+            return "ERROR";
+        case LOG_WARN:
+            return "WARN";
+        case LOG_INFO:
+            return "INFO";
+        case LOG_DEBUG:
+            return "DEBUG";
+        default:
+            return "NONE";
+    }
+}
+
+int Logging_KVToJson(const Logging_KVRecord_t *record, const char *module_name, char *buffer, size_t size)
+{
+    Json_Output_t out = { buffer, size, 0u };
+    Logging_KVValue_t field;
+    size_t offset = 0u;
+    const char *separator = "";
+    int status;
+
+    if (size > 0u)
+    {
+        buffer[0] = '\0';
+    }
+
+    json_append(&out, "{\"level\":\"%s\",\"module\":%u,", level_name(record->level), (unsigned)record->module);
+    if (module_name != NULL)
+    {
+        json_append(&out, "\"module_name\":");
+        json_append_string(&out, module_name, strlen(module_name));
+        json_append(&out, ",");
+    }
+    json_append(&out, "\"line\":%u,\"event\":", (unsigned)record->line);
+    json_append_string(&out, record->event, record->event_length);
+    json_append(&out, ",\"fields\":{");
+
+    while ((status = Logging_KVNextField(record, &offset, &field)) > 0)
+    {
+        json_append(&out, "%s", separator);
+        json_append_string(&out, field.key, field.key_length);
+        json_append(&out, ":");
+
+        switch (field.type)
+        {
+            case LOGGING_KV_TYPE_U32:
+                json_append(&out, "%lu", (unsigned long)field.value.u32);
+                break;
+            case LOGGING_KV_TYPE_I32:
+                json_append(&out, "%ld", (long)field.value.i32);
+                break;
+            case LOGGING_KV_TYPE_U64:
+                json_append(&out, "%llu", (unsigned long long)field.value.u64);
+                break;
+            case LOGGING_KV_TYPE_I64:
+                json_append(&out, "%lld", (long long)field.value.i64);
+                break;
+            case LOGGING_KV_TYPE_F32:
+                /* JSON has no inf/nan */
+                if (isfinite(field.value.f32))
+                {
+                    json_append(&out, "%.9g", (double)field.value.f32);
+                }
+                else
+                {
+                    json_append(&out, "null");
+                }
+                break;
+            case LOGGING_KV_TYPE_BOOL:
+                json_append(&out, "%s", field.value.boolean ? "true" : "false");
+                break;
+            default: /* LOGGING_KV_TYPE_STR */
+                json_append_string(&out, field.value.str.data, field.value.str.length);
+                break;
+        }
+        separator = ",";
+    }
+    if (status < 0)
+    {
+        return -1;
+    }
+
+    json_append(&out, "%s", record->truncated ? "},\"truncated\":true}" : "}}");
+
+    return (out.length > (size_t)2147483647) ? 2147483647 : (int)out.length;
+}
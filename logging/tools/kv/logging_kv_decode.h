@@ -0,0 +1,121 @@
+/**
+ * @file: logging_kv_decode.h
+ * @author: Paweł Kawula (pawel.kawula@kelectronics.pl)
+ * @brief: Host-side decoder of LOGGING_KV binary records
+ * -----
+ * Copyright 2025 - KElectronics
+ * -----
+ * @note: Works directly on the received bytes, nothing is copied or
+ *        allocated. Strings point into the input and are not NUL terminated.
+ *        Record layout is described in logging_kv.h.
+ */
+
+#ifndef LOGGING_KV_DECODE_H
+#define LOGGING_KV_DECODE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "logging_kv.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * @brief Header of one decoded record.
+ */
+typedef struct
+{
+    uint8_t level;          /**< LOG_ERROR ... LOG_DEBUG */
+    uint8_t truncated;      /**< Non-zero when the target left fields out */
+    uint16_t module;        /**< LOGGING_MODULE_ID of the call site */
+    uint16_t line;          /**< Source line of the call site */
+    const char *event;      /**< Event name (event_length characters) */
+    size_t event_length;
+    const uint8_t *fields;  /**< Encoded fields, walked by Logging_KVNextField() */
+    size_t fields_length;
+} Logging_KVRecord_t;
+
+/**
+ * @brief One decoded field.
+ */
+typedef struct
+{
+    uint8_t type;           /**< LOGGING_KV_TYPE_* */
+    const char *key;        /**< Key (key_length characters) */
+    size_t key_length;
+    union
+    {
+        uint32_t u32;
+        int32_t i32;
+        uint64_t u64;
+        int64_t i64;
+        float f32;
+        int boolean;
+        struct
+        {
+            const char *data;
+            size_t length;
+        } str;
+    } value;
+} Logging_KVValue_t;
+
+/**
+ * @brief Decode the record at the start of a byte stream.
+ *
+ * @param data   Received bytes.
+ * @param length Number of bytes available.
+ * @param record Decoded header.
+ * @return long Bytes taken by the record, 0 when more data is needed,
+ *              -1 when the bytes are not a valid record.
+ */
+long Logging_KVDecode(const uint8_t *data, size_t length, Logging_KVRecord_t *record);
+
+/**
+ * @brief Get the next field of a decoded record.
+ *
+ * @param record Record returned by Logging_KVDecode().
+ * @param offset Iteration state, set to 0 before the first call.
+ * @param field  Decoded field.
+ * @return int 1 when a field was decoded, 0 at the end, -1 when malformed.
+ *
+ * @example
+ * @code
+ * size_t offset = 0;
+ * Logging_KVValue_t field;
+ * while (Logging_KVNextField(&record, &offset, &field) > 0) {
+ *     printf("%.*s\n", (int)field.key_length, field.key);
+ * }
+ * @endcode
+ */
+int Logging_KVNextField(const Logging_KVRecord_t *record, size_t *offset, Logging_KVValue_t *field);
+
+/**
+ * @brief Compute the LOGGING_MODULE_ID the target derives from a LOGGING_LOG_NAME.
+ *
+ * @param name Module name.
+ * @return uint16_t Module identifier (1..65535).
+ */
+uint16_t Logging_KVModuleId(const char *name);
+
+/**
+ * @brief Render a decoded record as a single line JSON object.
+ *
+ * {"level":"INFO","module":3,"line":42,"event":"rx","fields":{"len":12,"port":"uart1"}}
+ * A "truncated":true member is added when the target left fields out.
+ *
+ * @param record      Record returned by Logging_KVDecode().
+ * @param module_name Name added as "module_name" after "module", NULL to leave it out.
+ * @param buffer      Output buffer, always NUL terminated when size > 0.
+ * @param size        Size of the output buffer.
+ * @return int Length of the complete object (snprintf semantics), -1 when a field is malformed.
+ */
+int Logging_KVToJson(const Logging_KVRecord_t *record, const char *module_name, char *buffer, size_t size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LOGGING_KV_DECODE_H */
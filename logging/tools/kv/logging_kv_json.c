@@ -0,0 +1,130 @@
+/**
+ * @file: logging_kv_json.c
+ * @author:: Paweł Kawula (pawel.kawula@kelectronics.pl)
+ * -----
+ * Copyright 2025 - KElectronics
+ * -----
+ * @note: Converts a LOGGING_KV record stream (file or stdin) into JSON lines,
+ *        one object per record.
+ *        Usage: logging_kv_json [-m NAME]... [stream]
+ *        Every -m adds a LOGGING_LOG_NAME whose hashed ID is resolved to
+ *        "module_name" in the output.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "logging_kv_decode.h"
+
+/* Largest record is 2 + 65535 bytes */
+static uint8_t stream[2u * 65537u];
+
+static char json[8u * 65537u];
+
+#define MAX_MODULES 256
+
+static const char *module_names[MAX_MODULES];
+static uint16_t module_ids[MAX_MODULES];
+static size_t module_count;
+
+static const char *module_name(uint16_t id)
+{
+    for (size_t i = 0; i < module_count; i++)
+    {
+        if (module_ids[i] == id)
+        {
+            return module_names[i];
+        }
+    }
+    return NULL;
+}
+
+int main(int argc, char **argv)
+{
+    FILE *input = stdin;
+    const char *path = NULL;
+    size_t length = 0u;
+    size_t skipped = 0u;
+    int status = 0;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "-m") == 0) && ((i + 1) < argc) && (module_count < MAX_MODULES))
+        {
+            module_names[module_count] = argv[++i];
+            module_ids[module_count] = Logging_KVModuleId(argv[i]);
+            module_count++;
+        }
+        else if ((path == NULL) && ((argv[i][0] != '-') || (argv[i][1] == '\0')))
+        {
+            path = argv[i];
+        }
+        else
+        {
+            fprintf(stderr, "usage: %s [-m NAME]... [stream]\n", argv[0]);
+            return 2;
+        }
+    }
+    if ((path != NULL) && (strcmp(path, "-") != 0))
+    {
+        input = fopen(path, "rb");
+        if (input == NULL)
+        {
+            perror(path);
+            return 2;
+        }
+    }
+
+    for (;;)
+    {
+        size_t received = fread(&stream[length], 1u, sizeof(stream) - length, input);
+        size_t position = 0u;
+
+        length += received;
+
+        while (position < length)
+        {
+            Logging_KVRecord_t record;
+            long taken = Logging_KVDecode(&stream[position], length - position, &record);
+
+            if (taken == 0)
+            {
+                break;
+            }
+            if ((taken < 0) || (Logging_KVToJson(&record, module_name(record.module), json, sizeof(json)) < 0))
+            {
+                /* Lost framing - resynchronize on the next byte */
+                position++;
+                skipped++;
+                continue;
+            }
+            puts(json);
+            position += (size_t)taken;
+        }
+
+        memmove(stream, &stream[position], length - position);
+        length -= position;
+
+        if (received == 0u)
+        {
+            break;
+        }
+    }
+
+    if (length > 0u)
+    {
+        fprintf(stderr, "%zu bytes of an incomplete record at the end of the stream\n", length);
+        status = 1;
+    }
+    if (skipped > 0u)
+    {
+        fprintf(stderr, "%zu bytes skipped while resynchronizing\n", skipped);
+        status = 1;
+    }
+    if (input != stdin)
+    {
+        fclose(input);
+    }
+
+    return status;
+}
@@ -0,0 +1,294 @@
+#!/usr/bin/env python3
+"""Host side of tokenized logging (LOGGING_TOKENIZED) and scope tracing (LOGGING_TRACE).
+
+Commands:
+  dictionary <elf> -o <file>     Extract the .logging_tokens section of a linked
+                                 image and write the token dictionary.
+  decode <dictionary> [stream]   Decode a binary frame stream (file or stdin)
+                                 back into text.
+  trace <dictionary> [stream]    Convert a trace event stream (file or stdin)
+                                 to Chrome trace / Perfetto JSON.
+
+Dictionary format: one entry per line, "<token hex>\t<JSON string>".
+"""
+
+import argparse
+import json
+import re
+import struct
+import sys
+
+SECTION_NAME = ".logging_tokens"
+HASH_LENGTH = 128  # Must match LOGGING_TOKEN_HASH_LENGTH in logging_tokens.h
+HASH_CONSTANT = 65599
+
+ARG_SPEC = re.compile(
+    r"%(?P<flags>[-+ #0]*)(?P<width>\d+)?(?:\.(?P<precision>\d+))?"
+    r"(?P<length>hh|h|ll|l|j|z|t|L)?(?P<conv>[diouxXeEfFgGaAcsp%])"
+)
+
+# "@<ticks> " slot inserted after the level tag by LOGGING_TIMESTAMP
+TIMESTAMP = re.compile(r"^(\[\w+\]\s+)@(\d+) ")
+
+
+def convert_timestamp(match, frequency):
+    ticks = int(match.group(2))
+    return f"{match.group(1)}@{ticks // frequency}.{(ticks % frequency) * 1000000 // frequency:06d} "
+
+
+def token_hash(data: bytes) -> int:
+    """Same 65599 hash as LOGGING_TOKEN_HASH()."""
+    value = len(data)
+    coefficient = HASH_CONSTANT
+    for byte in data[:HASH_LENGTH]:
+        value = (value + byte * coefficient) & 0xFFFFFFFF
+        coefficient = (coefficient * HASH_CONSTANT) & 0xFFFFFFFF
+    return value
+
+
+def read_section(path: str, name: str) -> bytes:
+    """Return the contents of an ELF section, minimal parser (32/64 bit, any endianness)."""
+    with open(path, "rb") as elf:
+        image = elf.read()
+
+    if image[:4] != b"\x7fELF":
+        raise SystemExit(f"{path}: not an ELF file")
+
+    is_64 = image[4] == 2
+    endian = "<" if image[5] == 1 else ">"
+
+    if is_64:
+        shoff, = struct.unpack_from(endian + "Q", image, 0x28)
+        shentsize, shnum, shstrndx = struct.unpack_from(endian + "HHH", image, 0x3A)
+        header = endian + "IIQQQQIIQQ"
+    else:
+        shoff, = struct.unpack_from(endian + "I", image, 0x20)
+        shentsize, shnum, shstrndx = struct.unpack_from(endian + "HHH", image, 0x2E)
+        header = endian + "IIIIIIIIII"
+
+    sections = [struct.unpack_from(header, image, shoff + i * shentsize) for i in range(shnum)]
+    names_offset = sections[shstrndx][4]
+
+    for section in sections:
+        start = names_offset + section[0]
+        section_name = image[start:image.index(b"\0", start)].decode()
+        if section_name == name:
+            if section[1] == 8:  # SHT_NOBITS
+                raise SystemExit(f"{path}: {name} has no contents, use (INFO) instead of (NOLOAD)")
+            return image[section[4]:section[4] + section[5]]
+
+    return b""
+
+
+def command_dictionary(args):
+    entries = {}
+    for raw in read_section(args.elf, SECTION_NAME).split(b"\0"):
+        if not raw:
+            continue  # Padding between entries
+        token = token_hash(raw)
+        text = raw.decode("utf-8", errors="replace")
+        if token in entries and entries[token] != text:
+            raise SystemExit(f"token collision 0x{token:08x}: {entries[token]!r} / {text!r}")
+        entries[token] = text
+
+    with open(args.output, "w", encoding="utf-8") as out:
+        for token in sorted(entries):
+            out.write(f"{token:08x}\t{json.dumps(entries[token])}\n")
+
+
+def load_dictionary(path):
+    entries = {}
+    with open(path, encoding="utf-8") as dictionary:
+        for line in dictionary:
+            token, _, text = line.rstrip("\n").partition("\t")
+            if token:
+                entries[int(token, 16)] = json.loads(text)
+    return entries
+
+
+class Reader:
+    def __init__(self, data: bytes):
+        self.data = data
+        self.offset = 0
+
+    def varint(self) -> int:
+        value = 0
+        shift = 0
+        while True:
+            if self.offset >= len(self.data):
+                raise EOFError
+            byte = self.data[self.offset]
+            self.offset += 1
+            value |= (byte & 0x7F) << shift
+            shift += 7
+            if not byte & 0x80:
+                return value
+
+    def zigzag(self) -> int:
+        value = self.varint()
+        return (value >> 1) ^ -(value & 1)
+
+    def take(self, count: int) -> bytes:
+        if self.offset + count > len(self.data):
+            raise EOFError
+        chunk = self.data[self.offset:self.offset + count]
+        self.offset += count
+        return chunk
+
+
+def argument_bits(length, long_bits: int) -> int:
+    """Width of an integer argument, from its length modifier as printf reads it."""
+    if length in ("ll", "j"):
+        return 64
+    if length in ("l", "z", "t"):
+        return long_bits  # long, size_t and ptrdiff_t are pointer sized on ILP32 and LP64
+    if length == "h":
+        return 16
+    if length == "hh":
+        return 8
+    return 32
+
+
+def format_message(fmt: str, reader: Reader, long_bits: int = 32) -> str:
+    out = []
+    position = 0
+    for spec in ARG_SPEC.finditer(fmt):
+        out.append(fmt[position:spec.start()])
+        position = spec.end()
+        conv = spec.group("conv")
+        if conv == "%":
+            out.append("%")
+            continue
+
+        prefix = "%" + spec.group("flags") + (spec.group("width") or "")
+        if spec.group("precision") is not None:
+            prefix += "." + spec.group("precision")
+
+        try:
+            if conv == "s":
+                out.append((prefix + "s") % reader.take(reader.varint()).decode("utf-8", errors="replace"))
+            elif conv == "p":
+                out.append((prefix + "s") % f"0x{reader.varint():x}")
+            elif conv in "eEfFgGaA":
+                value, = struct.unpack("<f", reader.take(4))
+                out.append((prefix + ("g" if conv in "aA" else conv)) % value)
+            else:
+                # Integers are sent sign-extended from their C type, cut back to the width printf converts
+                bits = 8 if conv == "c" else argument_bits(spec.group("length"), long_bits)
+                value = reader.zigzag() & ((1 << bits) - 1)
+                if conv in "di":
+                    if value >> (bits - 1):
+                        value -= 1 << bits
+                    out.append((prefix + "d") % value)
+                else:
+                    out.append((prefix + conv) % (chr(value) if conv == "c" else value))
+        except EOFError:
+            out.append("<truncated>")
+            return "".join(out)
+
+    out.append(fmt[position:])
+    return "".join(out)
+
+
+def command_decode(args):
+    entries = load_dictionary(args.dictionary)
+    stream = open(args.stream, "rb").read() if args.stream else sys.stdin.buffer.read()
+    reader = Reader(stream)
+
+    while reader.offset < len(stream):
+        try:
+            frame = Reader(reader.take(reader.varint()))
+            token, = struct.unpack("<I", frame.take(4))
+        except EOFError:
+            sys.stderr.write("incomplete frame at end of stream\n")
+            break
+
+        if token not in entries:
+            sys.stdout.write(f"<unknown token 0x{token:08x}>\n")
+            continue
+        text = format_message(entries[token], frame, args.long_bits).replace("\r\n", "\n")
+        if args.timestamp_hz:
+            text = TIMESTAMP.sub(lambda match: convert_timestamp(match, args.timestamp_hz), text, count=1)
+        sys.stdout.write(text)
+
+
+TRACE_PHASES = "BE"  # LOGGING_TRACE_BEGIN / LOGGING_TRACE_END
+TRACE_HEADER = struct.Struct("<BBI")  # phase, track, name (after the length byte)
+
+
+def command_trace(args):
+    entries = load_dictionary(args.dictionary)
+    stream = open(args.stream, "rb").read() if args.stream else sys.stdin.buffer.read()
+    frequency = args.timestamp_hz or 1000000  # Without a frequency ticks are taken as microseconds
+    events = []
+    offset = 0
+    last = None
+    elapsed = 0
+
+    while offset < len(stream):
+        length = stream[offset]
+        event = stream[offset + 1:offset + 1 + length]
+        offset += 1 + length
+        if len(event) != length or length <= TRACE_HEADER.size:
+            sys.stderr.write("incomplete event at end of stream\n")
+            break
+
+        phase, track, name = TRACE_HEADER.unpack_from(event)
+        ticks = int.from_bytes(event[TRACE_HEADER.size:], "little")
+        if chr(phase) not in TRACE_PHASES:
+            sys.stderr.write(f"unknown event phase 0x{phase:02x}\n")
+            continue
+
+        # Unwrap the raw counter, it may be narrower than the trace is long. Events of
+        # different tracks can arrive slightly out of order: steps back are kept negative.
+        span = 1 << (8 * (length - TRACE_HEADER.size))
+        if last is not None:
+            step = (ticks - last) % span
+            elapsed += step - span if step > span // 2 else step
+        last = ticks
+
+        events.append({
+            "name": entries.get(name, f"<unknown token 0x{name:08x}>"),
+            "ph": chr(phase),
+            "ts": elapsed * 1000000 / frequency,
+            "pid": 0,
+            "tid": track,
+        })
+
+    out = open(args.output, "w", encoding="utf-8") if args.output else sys.stdout
+    json.dump({"traceEvents": events, "displayTimeUnit": "ns"}, out, indent=1)
+    out.write("\n")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    commands = parser.add_subparsers(dest="command", required=True)
+
+    dictionary = commands.add_parser("dictionary", help="generate token dictionary from an ELF image")
+    dictionary.add_argument("elf")
+    dictionary.add_argument("-o", "--output", required=True)
+    dictionary.set_defaults(handler=command_dictionary)
+
+    decode = commands.add_parser("decode", help="decode a tokenized frame stream")
+    decode.add_argument("dictionary")
+    decode.add_argument("stream", nargs="?")
+    decode.add_argument("--timestamp-hz", type=int, default=0,
+                        help="convert LOGGING_TIMESTAMP ticks to seconds using this clock frequency")
+    decode.add_argument("--long-bits", type=int, choices=(32, 64), default=32,
+                        help="width of long, size_t and ptrdiff_t on the target: 32 (ILP32, default) or 64 (LP64)")
+    decode.set_defaults(handler=command_decode)
+
+    trace = commands.add_parser("trace", help="convert a trace event stream to Chrome trace JSON")
+    trace.add_argument("dictionary")
+    trace.add_argument("stream", nargs="?")
+    trace.add_argument("-o", "--output", help="JSON file, default stdout")
+    trace.add_argument("--timestamp-hz", type=int, default=0,
+                       help="LOGGING_TIMESTAMP clock frequency, default 1 MHz (ticks are microseconds)")
+    trace.set_defaults(handler=command_trace)
+
+    args = parser.parse_args()
+    args.handler(args)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,108 @@
+#!/usr/bin/env python3
+"""Host side of the compressor stage (LOGGING_COMPRESS).
+
+Usage:
+  logging_unpack.py [stream] [-o output]
+
+Restores the original byte stream (text lines, tokenized frames, key/value
+records) from a stream of compressed blocks read from a file or stdin. The
+output can be passed on to logging_tokens.py decode or logging_kv_json.
+
+A stream captured from the middle is decoded from its first block marked
+LOGGING_COMPRESS_RESTART; earlier blocks need history that was not captured.
+"""
+
+import argparse
+import struct
+import sys
+
+HEADER_SIZE = 4      # Must match LOGGING_COMPRESS_HEADER_SIZE in logging_compress.h
+RESTART = 0x8000     # Must match LOGGING_COMPRESS_RESTART
+HISTORY = 65535      # Largest LZ4 match offset
+
+
+def lz4_block(data: bytes, history: bytearray) -> None:
+    """Decode LZ4 block sequences, appending to history (matches may reach into earlier blocks)."""
+    position = 0
+
+    def length(value):
+        nonlocal position
+        if value == 15:
+            while True:
+                byte = data[position]
+                position += 1
+                value += byte
+                if byte != 255:
+                    break
+        return value
+
+    while position < len(data):
+        token = data[position]
+        position += 1
+
+        literals = length(token >> 4)
+        history += data[position:position + literals]
+        position += literals
+        if position >= len(data):
+            break  # Last sequence, literals only
+
+        offset = data[position] | (data[position + 1] << 8)
+        position += 2
+        match = length(token & 15) + 4
+        if offset == 0 or offset > len(history):
+            raise ValueError("match offset outside the history")
+
+        start = len(history) - offset
+        for i in range(match):  # Byte by byte: a match may overlap its own output
+            history.append(history[start + i])
+
+
+def unpack(stream, out) -> None:
+    history = bytearray()
+    synced = False
+
+    while True:
+        header = stream.read(HEADER_SIZE)
+        if len(header) < HEADER_SIZE:
+            break
+
+        length, stored = struct.unpack("<HH", header)
+        restart = (length & RESTART) != 0
+        length &= ~RESTART
+        payload = stream.read(stored)
+        if len(payload) < stored:
+            sys.stderr.write("truncated block at the end of the stream\n")
+            break
+
+        if restart:
+            history.clear()
+            synced = True
+        if not synced:
+            continue  # Needs history from before the capture
+        begin = len(history)
+
+        if stored == length:
+            history += payload
+        else:
+            lz4_block(payload, history)
+            if len(history) - begin != length:
+                raise SystemExit("corrupt block: decoded length does not match")
+
+        out.write(history[begin:])
+        if len(history) > 2 * HISTORY:
+            del history[:len(history) - HISTORY]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("stream", nargs="?", help="compressed stream, default stdin")
+    parser.add_argument("-o", "--output", help="restored stream, default stdout")
+    args = parser.parse_args()
+
+    stream = open(args.stream, "rb") if args.stream else sys.stdin.buffer
+    out = open(args.output, "wb") if args.output else sys.stdout.buffer
+    unpack(stream, out)
+
+
+if __name__ == "__main__":
+    main()
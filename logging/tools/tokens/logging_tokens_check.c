@@ -0,0 +1,83 @@
+/**
+ * @file: logging_tokens_check.c
+ * @author:: Paweł Kawula (pawel.kawula@kelectronics.pl)
+ * -----
+ * Copyright 2025 - KElectronics
+ * -----
+ * @note: Device side of the token decoder check, see logging_tokens_check.py.
+ *        Usage: logging_tokens_check <frames> <expected>
+ *        Every case is logged as a tokenized frame to <frames> and printed
+ *        with printf to <expected>, one line per case.
+ */
+
+#include <inttypes.h>
+#include <limits.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "logging.h"
+
+static FILE *frames;
+static FILE *expected;
+
+static int frames_write(const uint8_t *data, size_t length)
+{
+    return (int)fwrite(data, 1, length, frames);
+}
+
+#define CHECK(...)                                  \
+    do                                              \
+    {                                               \
+        LogInfo(__VA_ARGS__);                       \
+        (void)fprintf(expected, __VA_ARGS__);       \
+        (void)fputc('\n', expected);                \
+    } while (0)
+
+int main(int argc, char **argv)
+{
+    if (argc != 3)
+    {
+        (void)fprintf(stderr, "usage: %s <frames> <expected>\n", argv[0]);
+        return 2;
+    }
+    frames = fopen(argv[1], "wb");
+    expected = fopen(argv[2], "w");
+    if ((frames == NULL) || (expected == NULL))
+    {
+        perror("logging_tokens_check");
+        return 2;
+    }
+
+    Logging_InitTokenized(frames_write);
+
+    /* No length modifier: 32 bits */
+    CHECK("d %d %d %d", INT32_MIN, -1, INT32_MAX);
+    CHECK("u %u x %x X %X", (uint32_t)-1, (uint32_t)-1, 0xdeadbeefu);
+    CHECK("o %o c %c", 0777u, 'A');
+    CHECK("width [%8d] [%-8x] [%08u]", -42, 0xabu, 7u);
+
+    /* hh, h: cut to the promoted type */
+    CHECK("hh %hhd %hhu %hhx", (signed char)-3, (unsigned char)200, (unsigned char)0xab);
+    CHECK("h %hd %hu %hx", (short)-2, (unsigned short)65535, (unsigned short)0x8000);
+
+    /* ll, j: 64 bits */
+    CHECK("lld %lld %lld", (long long)INT64_MIN, (long long)INT64_MAX);
+    CHECK("llu %llu llx %llx", (unsigned long long)UINT64_MAX, (unsigned long long)UINT64_MAX);
+    CHECK("jd %jd ju %ju", INTMAX_MIN, UINTMAX_MAX);
+    CHECK("PRI %" PRId64 " %" PRIu64 " %" PRIx64, INT64_MIN, UINT64_MAX, (uint64_t)1 << 63);
+
+    /* l, z, t: width of the target's long (--long-bits) */
+    CHECK("ld %ld lu %lu", LONG_MIN, ULONG_MAX);
+    CHECK("lx %lx", (unsigned long)-16);
+    CHECK("zu %zu zd %zd", SIZE_MAX, (ptrdiff_t)-5);
+    CHECK("td %td tu %tu", PTRDIFF_MIN, (size_t)PTRDIFF_MAX);
+
+    /* Mixed widths in one frame */
+    CHECK("mix %d %llu %hhd %lx %u", -1, (unsigned long long)UINT64_MAX, (signed char)-128, (unsigned long)-1, 0u);
+    CHECK("s %s %d", "text", -7);
+
+    (void)fclose(frames);
+    (void)fclose(expected);
+    return 0;
+}
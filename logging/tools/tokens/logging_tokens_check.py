@@ -0,0 +1,67 @@
+#!/usr/bin/env python3
+"""Token decoder check: decode the frames of logging_tokens_check and compare with printf.
+
+Usage:
+  logging_tokens_check.py <logging_tokens_check executable>
+
+Builds the dictionary from the executable, runs it, decodes its frames with
+logging_tokens.py (long of the host width) and compares every line with the
+printf output of the same call. Exits with 1 on a mismatch.
+"""
+
+import os
+import struct
+import subprocess
+import sys
+import tempfile
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), ".."))
+
+import logging_tokens  # noqa: E402
+
+
+def main():
+    if len(sys.argv) != 2:
+        raise SystemExit(__doc__)
+    executable = sys.argv[1]
+    long_bits = 8 * struct.calcsize("l")  # The check program is built for this host
+
+    with tempfile.TemporaryDirectory() as work:
+        frames_path = os.path.join(work, "frames.bin")
+        expected_path = os.path.join(work, "expected.txt")
+        subprocess.run([executable, frames_path, expected_path], check=True)
+
+        entries = {}
+        for raw in logging_tokens.read_section(executable, logging_tokens.SECTION_NAME).split(b"\0"):
+            if raw:
+                entries[logging_tokens.token_hash(raw)] = raw.decode("utf-8", errors="replace")
+
+        with open(frames_path, "rb") as frames_file:
+            stream = logging_tokens.Reader(frames_file.read())
+        with open(expected_path, encoding="utf-8") as expected_file:
+            expected = expected_file.read().splitlines()
+
+    decoded = []
+    while stream.offset < len(stream.data):
+        frame = logging_tokens.Reader(stream.take(stream.varint()))
+        token, = struct.unpack("<I", frame.take(4))
+        text = logging_tokens.format_message(entries.get(token, f"<unknown token 0x{token:08x}>"), frame, long_bits)
+        decoded.append(text.rstrip("\r\n"))
+
+    mismatches = 0
+    for index, line in enumerate(expected):
+        got = decoded[index] if index < len(decoded) else "<missing>"
+        # The decoded line keeps the level tag and location prefix of the log macro
+        if not got.endswith(line):
+            mismatches += 1
+            sys.stderr.write(f"case {index}: decoded {got!r}, printf {line!r}\n")
+    if len(decoded) != len(expected):
+        mismatches += 1
+        sys.stderr.write(f"{len(decoded)} frames for {len(expected)} cases\n")
+
+    print(f"logging_tokens_check: {len(expected)} cases, {mismatches} mismatches")
+    return 1 if mismatches else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())